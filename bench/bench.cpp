@@ -0,0 +1,781 @@
+//
+// Frame rendering benchmark.
+//
+// Runs the same repeatable scenarios against every backend
+// that was compiled in, without a real terminal or display:
+// ncurses draws into a pipe opened with newterm(),
+// VT writes to /dev/null, SDL uses software SDL_Renderer
+// on an offscreen surface and headless stays in memory.
+//
+// ./printer_bench [frames] [WxH] [replay=FILE] [backend ...]
+//
+// replay=FILE adds a run of recording made with TG::FrameRecorder,
+// looped if it has less frames than asked for.
+//
+// Backend names are matched by prefix, e.g. 'sdl'
+// runs every SDL render mode.
+//
+// Prints frames per second, nanoseconds per cell
+// and bytes sent to the terminal per frame.
+//
+#include "printer.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <random>
+
+#ifdef PRINTER_HAS_VT
+#include <fcntl.h>
+#endif
+
+#ifdef USE_CURSES
+#include <atomic>
+#endif
+
+#ifndef BENCH_DATA_DIR
+#define BENCH_DATA_DIR "."
+#endif
+
+const int kGlyphWidth  = 8;
+const int kGlyphHeight = 16;
+
+const int kWarmupFrames = 10;
+
+//
+// Colors are taken from fixed palette, so that ncurses
+// doesn't run out of color pairs and measures drawing,
+// not init_pair() failures: 15 x 15 fg / bg combinations
+// plus default pair 0 still fit into 8 bit COLOR_PAIR().
+//
+const uint32_t kPalette[] =
+{
+  0x000000, 0xAA0000, 0x00AA00, 0xAA5500,
+  0x0000AA, 0xAA00AA, 0x00AAAA, 0xAAAAAA,
+  0xFF5555, 0x55FF55, 0xFFFF55, 0x5555FF,
+  0xFF55FF, 0x55FFFF, 0xFFFFFF
+};
+
+const int kPaletteSize = sizeof(kPalette) / sizeof(kPalette[0]);
+
+const char* kWords[] =
+{
+  "printer", "frame", "buffer", "render", "cell", "glyph",
+  "color", "window", "span", "tileset", "cursor", "escape",
+  "[info]", "[warn]", "[error]", "ok", "failed", "retry"
+};
+
+const int kWordsCount = sizeof(kWords) / sizeof(kWords[0]);
+
+// =============================================================================
+
+struct Options
+{
+  int Frames = 300;
+  int Width  = 120;
+  int Height = 40;
+
+  std::string Replay;
+
+  std::vector<std::string> Backends;
+};
+
+// =============================================================================
+
+struct Result
+{
+  int Frames = 0;
+  double Seconds = 0.0;
+  size_t Bytes = 0;
+};
+
+// =============================================================================
+
+//
+// Every scenario gets the same sequence on every backend.
+//
+class Scenario
+{
+  public:
+    Scenario(const std::string& name) : Name(name), _rng(1) {}
+    virtual ~Scenario() = default;
+
+    const std::string Name;
+
+    void Reset()
+    {
+      _rng.seed(1);
+      OnReset();
+    }
+
+    //
+    // Called while printer scenario ran with is still alive.
+    //
+    void Finish()
+    {
+      OnFinish();
+    }
+
+  protected:
+    virtual void OnReset() {}
+    virtual void OnFinish() {}
+
+    int Random(int n)
+    {
+      return (int)(_rng() % (uint32_t)n);
+    }
+
+    uint32_t RandomColor()
+    {
+      return kPalette[Random(kPaletteSize)];
+    }
+
+    std::string RandomText(int maxWords)
+    {
+      std::string res;
+
+      int words = 1 + Random(maxWords);
+      for (int i = 0; i < words; i++)
+      {
+        if (i != 0)
+        {
+          res += ' ';
+        }
+
+        res += kWords[Random(kWordsCount)];
+      }
+
+      return res;
+    }
+
+  private:
+    std::mt19937 _rng;
+};
+
+// =============================================================================
+
+//
+// Draw() is a template over printer type, so it's not virtual.
+// It returns false if scenario has nothing to draw with this printer.
+//
+struct FullScreenText : public Scenario
+{
+  FullScreenText() : Scenario("random-text") {}
+
+  template <typename Printer>
+  bool Draw(Printer& printer, int)
+  {
+    int tw = printer.TerminalWidth();
+    int th = printer.TerminalHeight();
+
+    for (int y = 0; y < th; y++)
+    {
+      for (int x = 0; x < tw; x++)
+      {
+        printer.PrintFB(x, y, 33 + Random(94), RandomColor(), RandomColor());
+      }
+    }
+
+    return true;
+  }
+};
+
+// =============================================================================
+
+struct WindowStack : public Scenario
+{
+  WindowStack() : Scenario("window-stack") {}
+
+  template <typename Printer>
+  bool Draw(Printer& printer, int)
+  {
+    int tw = printer.TerminalWidth();
+    int th = printer.TerminalHeight();
+
+    for (int i = 0; i < 40; i++)
+    {
+      int w = 8 + Random(tw / 2);
+      int h = 3 + Random(th / 2);
+
+      printer.DrawWindow({ Random(tw - w), Random(th - h) },
+                         { w, h },
+                         kWords[Random(kWordsCount)],
+                         RandomColor(),
+                         RandomColor(),
+                         RandomColor(),
+                         RandomColor(),
+                         RandomColor());
+    }
+
+    return true;
+  }
+};
+
+// =============================================================================
+
+struct ScrollingLog : public Scenario
+{
+  ScrollingLog() : Scenario("scrolling-log") {}
+
+  template <typename Printer>
+  bool Draw(Printer& printer, int frame)
+  {
+    int th = printer.TerminalHeight();
+
+    //
+    // Few new lines each frame push old ones up.
+    //
+    for (int i = 0; i < 3; i++)
+    {
+      std::string line = "#" + std::to_string(frame) + " " + RandomText(12);
+      _lines.push_back({ line, kPalette[8 + Random(7)] });
+    }
+
+    while ((int)_lines.size() > th)
+    {
+      _lines.pop_front();
+    }
+
+    int y = 0;
+    for (auto& line : _lines)
+    {
+      printer.PrintFB(0, y, line.first, printer.kAlignLeft, line.second);
+      y++;
+    }
+
+    return true;
+  }
+
+  void OnReset() override
+  {
+    _lines.clear();
+  }
+
+  std::deque<std::pair<std::string, uint32_t>> _lines;
+};
+
+// =============================================================================
+
+struct AlignedChurn : public Scenario
+{
+  AlignedChurn() : Scenario("aligned-text") {}
+
+  template <typename Printer>
+  bool Draw(Printer& printer, int frame)
+  {
+    int tw = printer.TerminalWidth();
+    int th = printer.TerminalHeight();
+
+    for (int y = 0; y < th; y++)
+    {
+      int align = (y + frame) % 3;
+
+      int x = (align == printer.kAlignLeft)   ? 0
+            : (align == printer.kAlignCenter) ? tw / 2
+            : tw - 1;
+
+      printer.PrintFB(x, y, RandomText(6), align, RandomColor(), RandomColor());
+    }
+
+    return true;
+  }
+};
+
+// =============================================================================
+
+struct ImageHeavy : public Scenario
+{
+  ImageHeavy() : Scenario("images") {}
+
+  //
+  // Nothing to draw for text only backends.
+  //
+  template <typename Printer>
+  bool Draw(Printer&, int)
+  {
+    return false;
+  }
+
+  #ifdef USE_SDL
+  bool Draw(TG::BasicPrinter<TG::SDLBackend>& printer, int frame)
+  {
+    if (_images[0] == -1)
+    {
+      _images[0] = printer.LoadImage(BENCH_DATA_DIR "/trollface.bmp");
+      _images[1] = printer.LoadImage(BENCH_DATA_DIR "/plus.bmp", 0xFF00FF);
+    }
+
+    int pw = printer.TerminalWidth()  * kGlyphWidth;
+    int ph = printer.TerminalHeight() * kGlyphHeight;
+
+    printer.PrintFB(0, 0, RandomText(8), printer.kAlignLeft, RandomColor());
+
+    for (int i = 0; i < 200; i++)
+    {
+      int size = 16 + Random(64);
+
+      printer.DrawImage(_images[i % 2],
+                        { Random(pw - size), Random(ph - size), size, size },
+                        (frame + i) % 360);
+    }
+
+    return true;
+  }
+  #endif
+
+  //
+  // Images belong to the printer they were loaded with.
+  //
+  void OnReset() override
+  {
+    _images[0] = -1;
+    _images[1] = -1;
+  }
+
+  int _images[2] = { -1, -1 };
+};
+
+// =============================================================================
+
+struct Replay : public Scenario
+{
+  Replay() : Scenario("replay") {}
+
+  std::string Filename;
+
+  template <typename Printer>
+  bool Draw(Printer& printer, int)
+  {
+    if (printer.DrawRecordedFrame(_player))
+    {
+      return true;
+    }
+
+    _player.Rewind();
+
+    return printer.DrawRecordedFrame(_player);
+  }
+
+  void OnReset() override
+  {
+    _player.Open(Filename);
+  }
+
+  //
+  // Image handles kept in player belong to this printer.
+  //
+  void OnFinish() override
+  {
+    _player.Close();
+  }
+
+  TG::FramePlayer _player;
+};
+
+// =============================================================================
+
+//
+// BytesWritten is only filled by VT, other backends
+// count bytes sent to the terminal themselves in bytesFn.
+//
+template <typename Printer, typename S, typename BytesFn>
+Result RunScenario(Printer& printer, S& scenario, int frames, BytesFn& bytesFn)
+{
+  Result res;
+
+  scenario.Reset();
+
+  for (int i = 0; i < kWarmupFrames; i++)
+  {
+    printer.Clear();
+    if (!scenario.Draw(printer, i))
+    {
+      return res;
+    }
+
+    printer.Render();
+  }
+
+  size_t bytesBefore = bytesFn();
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < frames; i++)
+  {
+    printer.Clear();
+    if (!scenario.Draw(printer, kWarmupFrames + i))
+    {
+      return Result();
+    }
+
+    printer.Render();
+
+    res.Bytes += printer.GetFrameStats().BytesWritten;
+  }
+
+  auto end = std::chrono::steady_clock::now();
+
+  res.Bytes += bytesFn() - bytesBefore;
+
+  res.Frames  = frames;
+  res.Seconds = std::chrono::duration<double>(end - start).count();
+
+  return res;
+}
+
+// =============================================================================
+
+void Report(const std::string& backend,
+            const std::string& scenario,
+            const Result& res,
+            int cells)
+{
+  if (res.Frames == 0)
+  {
+    printf("%-16s %-14s %10s\n", backend.data(), scenario.data(), "n/a");
+    return;
+  }
+
+  double fps       = res.Frames / res.Seconds;
+  double nsPerCell = res.Seconds * 1e9 / ((double)res.Frames * cells);
+
+  printf("%-16s %-14s %10.1f %10.2f %12zu\n",
+         backend.data(),
+         scenario.data(),
+         fps,
+         nsPerCell,
+         res.Bytes / res.Frames);
+}
+
+// =============================================================================
+
+FullScreenText _fullScreenText;
+WindowStack    _windowStack;
+ScrollingLog   _scrollingLog;
+AlignedChurn   _alignedChurn;
+ImageHeavy     _imageHeavy;
+Replay         _replay;
+
+template <typename Printer, typename S, typename BytesFn>
+void Run(Printer& printer,
+         const std::string& backend,
+         S& scenario,
+         const Options& opts,
+         BytesFn& bytesFn)
+{
+  Result res = RunScenario(printer, scenario, opts.Frames, bytesFn);
+
+  scenario.Finish();
+
+  Report(backend,
+         scenario.Name,
+         res,
+         printer.TerminalWidth() * printer.TerminalHeight());
+}
+
+// =============================================================================
+
+//
+// Backend specific setup calls this with ready to use printer.
+//
+template <typename Printer, typename BytesFn>
+void RunAll(Printer& printer,
+            const std::string& backend,
+            const Options& opts,
+            BytesFn bytesFn)
+{
+  Run(printer, backend, _fullScreenText, opts, bytesFn);
+  Run(printer, backend, _windowStack,    opts, bytesFn);
+  Run(printer, backend, _scrollingLog,   opts, bytesFn);
+  Run(printer, backend, _alignedChurn,   opts, bytesFn);
+  Run(printer, backend, _imageHeavy,     opts, bytesFn);
+
+  if (not _replay.Filename.empty())
+  {
+    Run(printer, backend, _replay, opts, bytesFn);
+  }
+}
+
+// =============================================================================
+
+bool Selected(const Options& opts, const std::string& backend)
+{
+  if (opts.Backends.empty())
+  {
+    return true;
+  }
+
+  for (auto& name : opts.Backends)
+  {
+    if (backend.compare(0, name.length(), name) == 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// =============================================================================
+
+void BenchHeadless(const Options& opts)
+{
+  auto noBytes = [] { return (size_t)0; };
+
+  if (Selected(opts, "headless"))
+  {
+    TG::BasicPrinter<TG::HeadlessBackend> printer;
+    if (printer.Init(opts.Width, opts.Height, false))
+    {
+      RunAll(printer, "headless", opts, noBytes);
+    }
+  }
+
+  if (Selected(opts, "headless-pixels"))
+  {
+    TG::BasicPrinter<TG::HeadlessBackend> printer;
+    if (printer.Init(opts.Width, opts.Height, true))
+    {
+      RunAll(printer, "headless-pixels", opts, noBytes);
+    }
+  }
+}
+
+// =============================================================================
+
+#ifdef PRINTER_HAS_VT
+void BenchVT(const Options& opts)
+{
+  if (!Selected(opts, "vt"))
+  {
+    return;
+  }
+
+  int fd = open("/dev/null", O_WRONLY);
+  if (fd == -1)
+  {
+    printf("%s - can't open /dev/null\n", __PRETTY_FUNCTION__);
+    return;
+  }
+
+  {
+    TG::BasicPrinter<TG::VTBackend> printer;
+    if (printer.Init(fd, opts.Width, opts.Height))
+    {
+      RunAll(printer, "vt", opts, [] { return (size_t)0; });
+    }
+  }
+
+  close(fd);
+}
+#endif
+
+// =============================================================================
+
+#ifdef USE_CURSES
+//
+// Whatever ncurses writes into the pipe is counted
+// and thrown away by separate thread, so that
+// full pipe never blocks the rendering.
+//
+void BenchCurses(const Options& opts)
+{
+  if (!Selected(opts, "curses"))
+  {
+    return;
+  }
+
+  int fds[2];
+  if (pipe(fds) == -1)
+  {
+    printf("%s - pipe() failed\n", __PRETTY_FUNCTION__);
+    return;
+  }
+
+  std::atomic<size_t> bytes(0);
+
+  std::thread reader([&bytes, fds]
+  {
+    char buf[1 << 16];
+
+    ssize_t res;
+    while ((res = read(fds[0], buf, sizeof(buf))) > 0)
+    {
+      bytes += res;
+    }
+  });
+
+  FILE* out = fdopen(fds[1], "w");
+  FILE* in  = fopen("/dev/null", "r");
+
+  SCREEN* screen = newterm("xterm-256color", out, in);
+  if (screen == nullptr)
+  {
+    printf("%s - newterm() failed\n", __PRETTY_FUNCTION__);
+  }
+  else
+  {
+    set_term(screen);
+    resizeterm(opts.Height, opts.Width);
+    start_color();
+
+    if (COLOR_PAIRS < kPaletteSize * kPaletteSize + 1)
+    {
+      printf("%s - terminal has only %d color pairs, "
+             "colors will be wrong\n",
+             __PRETTY_FUNCTION__,
+             COLOR_PAIRS);
+    }
+
+    TG::BasicPrinter<TG::CursesBackend> printer;
+    printer.Init();
+
+    //
+    // Bytes still in the pipe when the last frame ends
+    // are counted with the next scenario.
+    //
+    RunAll(printer, "curses", opts, [&bytes, out]
+    {
+      fflush(out);
+      return bytes.load();
+    });
+
+    endwin();
+    delscreen(screen);
+  }
+
+  fclose(in);
+  fclose(out);
+
+  reader.join();
+
+  close(fds[0]);
+}
+#endif
+
+// =============================================================================
+
+#ifdef USE_SDL
+void BenchSDL(const Options& opts)
+{
+  int pw = opts.Width  * kGlyphWidth;
+  int ph = opts.Height * kGlyphHeight;
+
+  SDL_Surface* surface = SDL_CreateRGBSurface(0,
+                                              pw,
+                                              ph,
+                                              32,
+                                              0x00FF0000,
+                                              0x0000FF00,
+                                              0x000000FF,
+                                              0xFF000000);
+  if (surface == nullptr)
+  {
+    printf("%s - SDL_CreateRGBSurface() failed: %s\n",
+           __PRETTY_FUNCTION__,
+           SDL_GetError());
+    return;
+  }
+
+  const std::pair<const char*, TG::RenderMode> modes[] =
+  {
+    { "sdl-immediate", TG::RenderMode::Immediate },
+    { "sdl-batched",   TG::RenderMode::Batched   },
+    { "sdl-software",  TG::RenderMode::Software  }
+  };
+
+  for (auto& mode : modes)
+  {
+    if (!Selected(opts, mode.first))
+    {
+      continue;
+    }
+
+    SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(surface);
+    if (renderer == nullptr)
+    {
+      printf("%s - SDL_CreateSoftwareRenderer() failed: %s\n",
+             __PRETTY_FUNCTION__,
+             SDL_GetError());
+      break;
+    }
+
+    {
+      TG::BasicPrinter<TG::SDLBackend> printer;
+      if (printer.Init(renderer, pw, ph))
+      {
+        printer.SetRenderMode(mode.second);
+        RunAll(printer, mode.first, opts, [] { return (size_t)0; });
+      }
+    }
+
+    SDL_DestroyRenderer(renderer);
+  }
+
+  SDL_FreeSurface(surface);
+}
+#endif
+
+// =============================================================================
+
+int main(int argc, char* argv[])
+{
+  Options opts;
+
+  for (int i = 1; i < argc; i++)
+  {
+    int w = 0;
+    int h = 0;
+
+    std::string arg = argv[i];
+
+    if (arg.compare(0, 7, "replay=") == 0)
+    {
+      opts.Replay = arg.substr(7);
+    }
+    else if (sscanf(argv[i], "%dx%d", &w, &h) == 2 && w > 0 && h > 0)
+    {
+      opts.Width  = w;
+      opts.Height = h;
+    }
+    else if (atoi(argv[i]) > 0)
+    {
+      opts.Frames = atoi(argv[i]);
+    }
+    else
+    {
+      opts.Backends.push_back(argv[i]);
+    }
+  }
+
+  if (not opts.Replay.empty())
+  {
+    TG::FramePlayer player;
+    if (not player.Open(opts.Replay))
+    {
+      return 1;
+    }
+
+    _replay.Filename = opts.Replay;
+  }
+
+  printf("%d frames of %dx%d cells\n\n", opts.Frames, opts.Width, opts.Height);
+  printf("%-16s %-14s %10s %10s %12s\n",
+         "backend", "scenario", "frames/s", "ns/cell", "bytes/frame");
+
+  BenchHeadless(opts);
+
+  #ifdef PRINTER_HAS_VT
+  BenchVT(opts);
+  #endif
+
+  #ifdef USE_CURSES
+  BenchCurses(opts);
+  #endif
+
+  #ifdef USE_SDL
+  BenchSDL(opts);
+  #endif
+
+  return 0;
+}
@@ -5,6 +5,16 @@
 // with SDL2 or ncurses build.
 // Set the preferred library in 'Projects' tab of QT Creator
 // or set the 'USE_SDL' flag accordingly manually.
+// 'USE_VT' flag builds the version that writes escape sequences
+// directly to the terminal without ncurses.
+// 'USE_HEADLESS' flag builds the version that renders one frame
+// into memory and saves it as 'frame.ppm'.
+// 'USE_CURSES' adds ncurses version to any of the above.
+// 'PRINTER_TRACE' makes headless version also save 'trace.json'
+// for chrome://tracing (debug builds only).
+//
+// Every backend that was compiled in can be picked at startup:
+// ./printer [sdl|curses|vt|headless]
 //
 // Under Windows you may have to add manually
 // 'Add - File' in QT Creator named 'SDL2_LIBRARY'
@@ -13,7 +23,9 @@
 //
 #include "printer.h"
 
-TG::Printer _printer;
+#ifdef PRINTER_HAS_VT
+#include <termios.h>
+#endif
 
 const float kGlobalScale = 1.0f;
 
@@ -24,84 +36,94 @@ const int kWindowWidth  = 80 * kGlyphWidth * kGlobalScale;
 const int kWindowHeight = 24 * kGlyphHeight * kGlobalScale;
 
 #ifdef USE_SDL
-const std::string kExitString = "Press 'ESC' to exit";
-const std::string khBar       = "===================";
 const std::string kTrollFace  = "trollface.bmp";
 const std::string kPlus       = "plus.bmp";
 int _trollface = -1;
 int _plus = -1;
 int angle = 0;
-#else
-const std::string kExitString = "Press 'q' to exit";
-const std::string khBar       = "=================";
 #endif
 
-void Display()
+//
+// Nothing extra for text only backends.
+//
+template <typename Printer>
+void DrawExtras(Printer&)
 {
-  //
-  // Printer::Clear() should be called before any drawing.
-  //
-  _printer.Clear();
+}
 
+#ifdef USE_SDL
+void DrawExtras(TG::BasicPrinter<TG::SDLBackend>& printer)
+{
   //
-  // Do any drawing related stuff here.
+  // Can do images too, but SDL only.
   //
-  int tw = _printer.TerminalWidth();
-  int th = _printer.TerminalHeight();
+  printer.PrintFB(70, 5, "Transparency", printer.kAlignCenter, 0xFFFF00);
+  printer.DrawImage(_plus, { kWindowWidth - 128 - 10, 10, 128, 128 }, angle++);
 
-  std::string dims = std::to_string(tw) + "x" + std::to_string(th);
+  printer.DrawImage(_trollface, { 10, 10, 64, 64 });
+  printer.DrawImage(_trollface, { 84, 10, 64, 64 }, 0, SDL_RendererFlip::SDL_FLIP_HORIZONTAL);
+  printer.DrawImage(_trollface, { 48, 84, 64, 64 }, 0, SDL_RendererFlip::SDL_FLIP_VERTICAL);
 
-  _printer.PrintFB(tw - 1,
-                   th - 1,
-                   dims,
-                   TG::Printer::kAlignRight,
-                   TG::Colors::White);
-
-  _printer.PrintFB(40, 0, kExitString, TG::Printer::kAlignCenter, TG::Colors::White);
-  _printer.PrintFB(40, 1, khBar,       TG::Printer::kAlignCenter, TG::Colors::White);
-
-  _printer.PrintFB(40, 4, '|',  TG::Colors::White);
-  _printer.PrintFB(39, 5, '\\', TG::Colors::White);
-  _printer.PrintFB(41, 5, '/',  TG::Colors::White);
-
-  _printer.PrintFB(40, 6, "Left Align",   TG::Printer::kAlignLeft,   TG::Colors::White);
-  _printer.PrintFB(40, 7, "Center Align", TG::Printer::kAlignCenter, TG::Colors::White);
-  _printer.PrintFB(40, 8, "Right Align",  TG::Printer::kAlignRight,  TG::Colors::White);
-
-  _printer.DrawWindow({ 20, 10 },
-                      { 40,  6 },
-                      "Header",
-                      0xFFFFFF,
-                      0x4444FF,
-                      0xFFFFFF,
-                      0x004400,
-                      0x222222);
-
-  _printer.PrintFB(40,
-                   13,
-                   "Hello World!",
-                   TG::Printer::kAlignCenter,
-                   TG::Colors::White);
+  printer.PrintFB(10, 10, "Images too!", printer.kAlignCenter, 0x00FF00);
+}
+#endif
 
-  #ifdef USE_SDL
+template <typename Printer>
+void Display(Printer& printer, const std::string& exitString)
+{
   //
-  // Can do images too, but SDL only.
+  // Printer::Clear() should be called before any drawing.
   //
-  _printer.PrintFB(70, 5, "Transparency", TG::Printer::kAlignCenter, 0xFFFF00);
-  _printer.DrawImage(_plus, { kWindowWidth - 128 - 10, 10, 128, 128 }, angle++);
+  printer.Clear();
 
-  _printer.DrawImage(_trollface, { 10, 10, 64, 64 });
-  _printer.DrawImage(_trollface, { 84, 10, 64, 64 }, 0, SDL_RendererFlip::SDL_FLIP_HORIZONTAL);
-  _printer.DrawImage(_trollface, { 48, 84, 64, 64 }, 0, SDL_RendererFlip::SDL_FLIP_VERTICAL);
+  //
+  // Do any drawing related stuff here.
+  //
+  int tw = printer.TerminalWidth();
+  int th = printer.TerminalHeight();
 
-  _printer.PrintFB(10, 10, "Images too!", TG::Printer::kAlignCenter, 0x00FF00);
-  #endif
+  std::string dims = std::to_string(tw) + "x" + std::to_string(th);
+  std::string hBar(exitString.length(), '=');
+
+  printer.PrintFB(tw - 1,
+                  th - 1,
+                  dims,
+                  printer.kAlignRight,
+                  TG::Colors::White);
+
+  printer.PrintFB(40, 0, exitString, printer.kAlignCenter, TG::Colors::White);
+  printer.PrintFB(40, 1, hBar,       printer.kAlignCenter, TG::Colors::White);
+
+  printer.PrintFB(40, 4, '|',  TG::Colors::White);
+  printer.PrintFB(39, 5, '\\', TG::Colors::White);
+  printer.PrintFB(41, 5, '/',  TG::Colors::White);
+
+  printer.PrintFB(40, 6, "Left Align",   printer.kAlignLeft,   TG::Colors::White);
+  printer.PrintFB(40, 7, "Center Align", printer.kAlignCenter, TG::Colors::White);
+  printer.PrintFB(40, 8, "Right Align",  printer.kAlignRight,  TG::Colors::White);
+
+  printer.DrawWindow({ 20, 10 },
+                     { 40,  6 },
+                     "Header",
+                     0xFFFFFF,
+                     0x4444FF,
+                     0xFFFFFF,
+                     0x004400,
+                     0x222222);
+
+  printer.PrintFB(40,
+                  13,
+                  "Hello World!",
+                  printer.kAlignCenter,
+                  TG::Colors::White);
+
+  DrawExtras(printer);
 
   //
   // Printer::Render() should be called at the end of all drawing,
   // just like SDL_RenderPresent()
   //
-  _printer.Render();
+  printer.Render();
 }
 
 #ifdef USE_SDL
@@ -110,6 +132,8 @@ SDL_Window* _window     = nullptr;
 
 bool SDL2()
 {
+  TG::BasicPrinter<TG::SDLBackend> printer;
+
   if (SDL_Init(SDL_INIT_VIDEO) != 0)
   {
     printf("SDL_Init Error: %s\n", SDL_GetError());
@@ -159,12 +183,12 @@ bool SDL2()
   //
 
   /*
-  if (!_printer.Init(_renderer,
-                     "acorn-8x16.bmp",
-                     kGlyphWidth, kGlyphHeight,
-                     kWindowWidth,
-                     kWindowHeight,
-                     kGlobalScale))
+  if (!printer.Init(_renderer,
+                    "acorn-8x16.bmp",
+                    kGlyphWidth, kGlyphHeight,
+                    kWindowWidth,
+                    kWindowHeight,
+                    kGlobalScale))
   {
     return 1;
   }
@@ -173,16 +197,33 @@ bool SDL2()
   //
   // Or you can use embedded tileset.
   //
-  if (!_printer.Init(_renderer,
-                     kWindowWidth,
-                     kWindowHeight,
-                     kGlobalScale))
+  if (!printer.Init(_renderer,
+                    kWindowWidth,
+                    kWindowHeight,
+                    kGlobalScale))
   {
     return 1;
   }
 
-  _trollface = _printer.LoadImage(kTrollFace);
-  _plus      = _printer.LoadImage(kPlus, 0xFF00FF);
+  //
+  // Optionally draw all glyphs of the frame
+  // with one SDL_RenderGeometry() call (SDL 2.0.18+).
+  //
+  // printer.SetRenderMode(TG::RenderMode::Batched);
+  //
+  // Or rasterize glyphs on CPU, which is faster
+  // with software SDL_Renderer.
+  //
+  // printer.SetRenderMode(TG::RenderMode::Software);
+
+  //
+  // Images can share atlas textures to cut texture switches
+  // when there are lots of them.
+  //
+  // printer.SetImageAtlasing(true);
+
+  _trollface = printer.LoadImage(kTrollFace);
+  _plus      = printer.LoadImage(kPlus, 0xFF00FF);
 
   bool running = true;
   while (running)
@@ -195,16 +236,20 @@ bool SDL2()
       running = false;
     }
 
-    Display();
+    Display(printer, "Press 'ESC' to exit");
   }
 
   SDL_Quit();
 
   return 0;
 }
-#else
+#endif
+
+#ifdef USE_CURSES
 bool Curses()
 {
+  TG::BasicPrinter<TG::CursesBackend> printer;
+
   initscr();
   nodelay(stdscr, true);
   keypad(stdscr, true);
@@ -213,13 +258,13 @@ bool Curses()
 
   start_color();
 
-  _printer.Init();
+  printer.Init();
 
   char ch;
 
   while ((ch = getch()) != 'q')
   {
-    Display();
+    Display(printer, "Press 'q' to exit");
   }
 
   endwin();
@@ -228,17 +273,122 @@ bool Curses()
 }
 #endif
 
+#ifdef PRINTER_HAS_VT
+bool VT()
+{
+  TG::BasicPrinter<TG::VTBackend> printer;
+
+  //
+  // Terminal setup is up to the user, just like with ncurses:
+  // read keys without waiting for Enter and don't echo them.
+  //
+  termios saved;
+  tcgetattr(STDIN_FILENO, &saved);
+
+  termios raw = saved;
+  raw.c_lflag &= ~(ICANON | ECHO);
+  raw.c_cc[VMIN]  = 0;
+  raw.c_cc[VTIME] = 0;
+  tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+
+  //
+  // Switch to alternate screen and hide cursor.
+  //
+  printf("\x1b[?1049h\x1b[?25l");
+  fflush(stdout);
+
+  bool ok = printer.Init();
+
+  char ch = 0;
+
+  while (ok && ch != 'q')
+  {
+    if (read(STDIN_FILENO, &ch, 1) != 1)
+    {
+      ch = 0;
+    }
+
+    Display(printer, "Press 'q' to exit");
+  }
+
+  printf("\x1b[0m\x1b[?25h\x1b[?1049l");
+  fflush(stdout);
+
+  tcsetattr(STDIN_FILENO, TCSANOW, &saved);
+
+  return !ok;
+}
+#endif
+
+bool Headless()
+{
+  TG::BasicPrinter<TG::HeadlessBackend> printer;
+
+  if (!printer.Init(80, 24, true))
+  {
+    return 1;
+  }
+
+  Display(printer, "Press 'q' to exit");
+
+  const TG::FrameStats& stats = printer.GetFrameStats();
+
+  printf("%dx%d cells, %d emitted\n",
+         printer.TerminalWidth(),
+         printer.TerminalHeight(),
+         stats.CellsEmitted);
+
+  #ifdef PRINTER_TRACING
+  TG::Trace::Dump("trace.json");
+  #endif
+
+  return !printer.DumpPPM("frame.ppm");
+}
+
 int main(int argc, char* argv[])
 {
-  std::ignore = argc;
-  std::ignore = argv;
+  #if defined(USE_SDL)
+  std::string backend = "sdl";
+  #elif defined(USE_VT)
+  std::string backend = "vt";
+  #elif defined(USE_HEADLESS)
+  std::string backend = "headless";
+  #else
+  std::string backend = "curses";
+  #endif
+
+  if (argc > 1)
+  {
+    backend = argv[1];
+  }
 
-  int ret = 0;
   #ifdef USE_SDL
-  ret = SDL2();
-  #else
-  ret = Curses();
+  if (backend == "sdl")
+  {
+    return SDL2();
+  }
+  #endif
+
+  #ifdef USE_CURSES
+  if (backend == "curses")
+  {
+    return Curses();
+  }
   #endif
 
-  return ret;
+  #ifdef PRINTER_HAS_VT
+  if (backend == "vt")
+  {
+    return VT();
+  }
+  #endif
+
+  if (backend == "headless")
+  {
+    return Headless();
+  }
+
+  printf("%s backend is not compiled in\n", backend.data());
+
+  return 1;
 }
@@ -5,48 +5,517 @@
 #define PRINTER_H
 
 #include <string>
+#include <cstdint>
 #include <map>
 #include <unordered_map>
 #include <vector>
+#include <utility>
 #include <cstdio>
+#include <cstring>
+#include <cerrno>
 #include <algorithm>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <ctime>
+#include <functional>
+#include <atomic>
 
-#ifndef USE_SDL
-  #include <ncurses.h>
-#else
+//
+// PRINTER_STATS adds draw call counters and timings
+// to FrameStats, see GetFrameStats().
+//
+// PRINTER_TRACE records scoped events of frame phases
+// for chrome://tracing, see Trace::Dump().
+// Release (NDEBUG) builds never have it.
+//
+#if defined(PRINTER_TRACE) && !defined(NDEBUG)
+  #define PRINTER_TRACING
+  #include <memory>
+#endif
+
+//
+// USE_SDL, USE_VT or USE_HEADLESS selects what TG::Printer is.
+// ncurses is the default and can be added to any of them
+// with USE_CURSES. Headless backend is always available,
+// VT backend is available on POSIX systems.
+//
+#if (defined(USE_SDL) + defined(USE_VT) + defined(USE_HEADLESS)) > 1
+  #error "Only one of USE_SDL, USE_VT and USE_HEADLESS can be defined"
+#endif
+
+#if !defined(USE_SDL) && !defined(USE_VT) && !defined(USE_HEADLESS) \
+ && !defined(USE_CURSES)
+  #define USE_CURSES
+#endif
+
+#if defined(USE_VT) || defined(__unix__) || defined(__APPLE__)
+  #define PRINTER_HAS_VT
+#endif
+
+#ifdef USE_SDL
+  #include <list>
+  #include <iterator>
+  #include <memory>
   #include "SDL2/SDL.h"
 #endif
 
+#ifdef PRINTER_HAS_VT
+  #include <unistd.h>
+  #include <poll.h>
+  #include <sys/ioctl.h>
+#endif
+
+#ifdef USE_CURSES
+  #include <ncurses.h>
+
+  //
+  // These are functions in ncurses too, but as macros
+  // they break std containers' clear() and erase().
+  //
+  #undef clear
+  #undef erase
+#endif
+
 ///
 /// For "Terminal Graphics"
 ///
 namespace TG
 {
   ///
-  /// Auxillary structs
+  /// Framebuffer cell packed into 8 bytes,
+  /// so rows can be filled, memcmp'd and hashed as plain memory.
   ///
-#ifdef USE_SDL
-  struct TileColor
+  struct FBPixel
   {
-    int R = 0;
-    int G = 0;
-    int B = 0;
+    // (fg << 24) | bg, see PackColorKey()
+    uint64_t ColorKey    : 48;
+    uint64_t Character   : 15;
+
+    // Background is not drawn (Colors::None, SDL only)
+    uint64_t Transparent : 1;
+
+    bool operator== (const FBPixel& rhs) const
+    {
+      return (Character   == rhs.Character
+           && ColorKey    == rhs.ColorKey
+           && Transparent == rhs.Transparent);
+    }
+
+    bool operator!= (const FBPixel& rhs) const
+    {
+      return not (*this == rhs);
+    }
+  };
+
+  static_assert(sizeof(FBPixel) == 8, "FBPixel is expected to be 8 bytes");
+
+  ///
+  /// Biggest character FBPixel::Character can hold.
+  ///
+  const int kMaxCharacter = 0x7FFF;
+
+  // ===========================================================================
+
+  const uint32_t kMaskR = 0x00FF0000;
+  const uint32_t kMaskG = 0x0000FF00;
+  const uint32_t kMaskB = 0x000000FF;
+
+  // ===========================================================================
+
+  inline uint64_t PackColorKey(const uint32_t& htmlColorFg,
+                               const uint32_t& htmlColorBg)
+  {
+    return ((uint64_t)(htmlColorFg & 0xFFFFFF) << 24)
+          | (uint64_t)(htmlColorBg & 0xFFFFFF);
+  }
+
+  // ===========================================================================
+
+  inline uint32_t GetKeyFg(uint64_t key)
+  {
+    return (key >> 24);
+  }
+
+  // ===========================================================================
+
+  inline uint32_t GetKeyBg(uint64_t key)
+  {
+    return (key & 0xFFFFFF);
+  }
+
+  // ===========================================================================
+
+  ///
+  /// Color components multiplied by factor / 256, factor is 0 - 256.
+  ///
+  inline uint32_t ScaleColor(uint32_t htmlColor, uint32_t factor)
+  {
+    uint32_t rb = (((htmlColor & 0xFF00FF) * factor) >> 8) & 0xFF00FF;
+    uint32_t g  = (((htmlColor & 0x00FF00) * factor) >> 8) & 0x00FF00;
+
+    return (rb | g);
+  }
+
+  // ===========================================================================
+
+  ///
+  /// From "from" (t = 0) to "to" (t = 256).
+  ///
+  inline uint32_t LerpColor(uint32_t from, uint32_t to, uint32_t t)
+  {
+    return ScaleColor(from, 256 - t) + ScaleColor(to, t);
+  }
+
+  // ===========================================================================
+
+  inline uint32_t GrayscaleColor(uint32_t htmlColor)
+  {
+    uint32_t r = (htmlColor >> 16) & 0xFF;
+    uint32_t g = (htmlColor >> 8)  & 0xFF;
+    uint32_t b = (htmlColor & 0xFF);
+
+    uint32_t luma = (r * 77 + g * 150 + b * 29) >> 8;
+
+    return (luma << 16) | (luma << 8) | luma;
+  }
+
+  // ===========================================================================
+
+  ///
+  /// Counters of the last Render() call.
+  ///
+  struct FrameStats
+  {
+    // Number of cells that actually went to the screen
+    int CellsEmitted = 0;
+
+    // Number of same colored horizontal spans these cells were sent in
+    // (for VT: number of cursor jumps)
+    int RunsEmitted = 0;
+
+    // Bytes of escape sequences and text sent to the terminal (VT only)
+    size_t BytesWritten = 0;
+
+    #ifdef PRINTER_STATS
+    // PrintFB() calls and cells written into framebuffer
+    // by all drawing calls since previous Render()
+    int PrintCalls   = 0;
+    int CellsWritten = 0;
+
+    // SDL_RenderCopy() and SDL_RenderCopyEx() calls (SDL only)
+    int RenderCopies = 0;
+
+    // SDL_SetTextureColorMod() calls (SDL only)
+    int ColorMods = 0;
+
+    // RenderCopies plus SDL_RenderGeometry()
+    // and SDL_RenderFillRects() calls (SDL only)
+    int DrawCalls = 0;
+
+    // init_pair() and init_color() calls (curses only)
+    int NewColorPairs = 0;
+    int NewColors     = 0;
+
+    // Color pair lookups (curses) or tinted tileset lookups (SDL)
+    int ColorCacheHits   = 0;
+    int ColorCacheMisses = 0;
+
+    // Wall time in microseconds spent in Clear(),
+    // between Clear() and Render() and in Render()
+    int64_t ClearTime  = 0;
+    int64_t DrawTime   = 0;
+    int64_t RenderTime = 0;
+    #endif
+  };
+
+  // ===========================================================================
+
+#ifdef PRINTER_TRACING
+  ///
+  /// "Complete" event of chrome://tracing, times are in nanoseconds.
+  ///
+  struct TraceEvent
+  {
+    const char* Name = nullptr;
+    int64_t Start    = 0;
+    int64_t Duration = 0;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Events of one thread. Only the owner thread writes here,
+  /// so there are no locks. Oldest events get overwritten.
+  ///
+  class TraceRing
+  {
+    public:
+      TraceRing(int threadId) : ThreadId(threadId)
+      {
+        for (size_t& last : _lastAtDepth)
+        {
+          last = kNone;
+        }
+      }
+
+      const int ThreadId;
+
+      // =======================================================================
+
+      void Enter()
+      {
+        _depth++;
+      }
+
+      // =======================================================================
+
+      /// Batch events continue the previous event with the same name
+      /// if nothing else ended on this nesting level in between,
+      /// so a run of PrintFB() calls shows up as one event.
+      void Leave(const char* name, int64_t start, int64_t end, bool batch)
+      {
+        _depth--;
+
+        size_t head = _head.load(std::memory_order_relaxed);
+
+        if (_depth >= kMaxDepth)
+        {
+          Push(head, name, start, end);
+          return;
+        }
+
+        for (int i = _depth + 1; i < kMaxDepth; i++)
+        {
+          _lastAtDepth[i] = kNone;
+        }
+
+        size_t last = _lastAtDepth[_depth];
+
+        if (batch
+         && last != kNone
+         && head - last <= kCapacity
+         && SameName(_events[last % kCapacity].Name, name))
+        {
+          TraceEvent& prev = _events[last % kCapacity];
+          prev.Duration = end - prev.Start;
+          return;
+        }
+
+        _lastAtDepth[_depth] = head;
+
+        Push(head, name, start, end);
+      }
+
+      // =======================================================================
+
+      /// Events still in the ring, oldest first.
+      std::vector<TraceEvent> Snapshot() const
+      {
+        size_t head = _head.load(std::memory_order_acquire);
+        size_t from = (head > kCapacity) ? head - kCapacity : 0;
+
+        std::vector<TraceEvent> res;
+        res.reserve(head - from);
+
+        for (size_t i = from; i < head; i++)
+        {
+          res.push_back(_events[i % kCapacity]);
+        }
+
+        return res;
+      }
+
+      // =======================================================================
+
+    private:
+      //
+      // Same literal may still have different addresses
+      // in different translation units.
+      //
+      static bool SameName(const char* a, const char* b)
+      {
+        return (a == b || strcmp(a, b) == 0);
+      }
+
+      // =======================================================================
+
+      void Push(size_t head, const char* name, int64_t start, int64_t end)
+      {
+        TraceEvent& e = _events[head % kCapacity];
+
+        e.Name     = name;
+        e.Start    = start;
+        e.Duration = end - start;
+
+        _head.store(head + 1, std::memory_order_release);
+      }
+
+      // =======================================================================
+
+      static const size_t kCapacity = 1 << 15;
+      static const int kMaxDepth    = 16;
+      static const size_t kNone     = SIZE_MAX;
+
+      TraceEvent _events[kCapacity];
+
+      std::atomic<size_t> _head{ 0 };
+
+      int _depth = 0;
+
+      //
+      // Ring position of the last event that ended on each nesting level.
+      //
+      size_t _lastAtDepth[kMaxDepth];
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Registry of all threads' rings.
+  ///
+  class Trace
+  {
+    public:
+      /// Nanoseconds since the first call.
+      static int64_t Now()
+      {
+        using namespace std::chrono;
+
+        static const steady_clock::time_point epoch = steady_clock::now();
+
+        return duration_cast<nanoseconds>(steady_clock::now() - epoch).count();
+      }
+
+      // =======================================================================
+
+      static TraceRing& ThisThread()
+      {
+        thread_local std::shared_ptr<TraceRing> ring;
+
+        if (ring == nullptr)
+        {
+          std::lock_guard<std::mutex> lock(Mutex());
+
+          ring = std::make_shared<TraceRing>((int)Rings().size() + 1);
+          Rings().push_back(ring);
+        }
+
+        return *ring;
+      }
+
+      // =======================================================================
+
+      /// Writes events of all threads as chrome://tracing JSON
+      /// (also opens in Perfetto). Rings are read without locks,
+      /// so call it between frames, not while other threads draw.
+      static bool Dump(const std::string& fname)
+      {
+        FILE* f = fopen(fname.data(), "w");
+        if (f == nullptr)
+        {
+          printf("%s - can't open %s: %s\n",
+                 __PRETTY_FUNCTION__,
+                 fname.data(),
+                 strerror(errno));
+          return false;
+        }
+
+        fprintf(f, "{\"traceEvents\":[");
+
+        bool first = true;
+
+        std::lock_guard<std::mutex> lock(Mutex());
+
+        for (auto& ring : Rings())
+        {
+          for (const TraceEvent& e : ring->Snapshot())
+          {
+            fprintf(f,
+                    "%s\n{\"name\":\"%s\",\"cat\":\"printer\",\"ph\":\"X\","
+                    "\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+                    first ? "" : ",",
+                    e.Name,
+                    e.Start / 1000.0,
+                    e.Duration / 1000.0,
+                    ring->ThreadId);
+
+            first = false;
+          }
+        }
+
+        fprintf(f, "\n]}\n");
+
+        return (fclose(f) == 0);
+      }
+
+      // =======================================================================
+
+    private:
+      static std::mutex& Mutex()
+      {
+        static std::mutex m;
+        return m;
+      }
+
+      // =======================================================================
+
+      static std::vector<std::shared_ptr<TraceRing>>& Rings()
+      {
+        static std::vector<std::shared_ptr<TraceRing>> rings;
+        return rings;
+      }
   };
 
   // ===========================================================================
 
-  struct TileInfo
+  ///
+  /// Records event from construction till destruction.
+  ///
+  class TraceScope
   {
-    int X = 0;
-    int Y = 0;
-    std::string Data;
+    public:
+      TraceScope(const char* name, bool batch = false)
+        : _ring(Trace::ThisThread()),
+          _name(name),
+          _batch(batch)
+      {
+        _ring.Enter();
+        _start = Trace::Now();
+      }
+
+      ~TraceScope()
+      {
+        _ring.Leave(_name, _start, Trace::Now(), _batch);
+      }
+
+    private:
+      TraceRing& _ring;
+
+      const char* _name;
+      bool _batch;
+      int64_t _start;
   };
+
+  #define PRINTER_TRACE_SCOPE(name) TG::TraceScope traceScope(name)
+  #define PRINTER_TRACE_BATCH(name) TG::TraceScope traceScope(name, true)
 #else
-  struct FBPixel
+  class Trace
   {
-    size_t ColorPairHash;
-    int Character;
+    public:
+      static bool Dump(const std::string&)
+      {
+        printf("%s - tracing is not compiled in "
+               "(needs PRINTER_TRACE without NDEBUG)\n",
+               __PRETTY_FUNCTION__);
+        return false;
+      }
   };
+
+  #define PRINTER_TRACE_SCOPE(name)
+  #define PRINTER_TRACE_BATCH(name)
 #endif
 
   // ===========================================================================
@@ -276,599 +745,5402 @@ namespace TG
 
   // ===========================================================================
 
-  class Printer
+  ///
+  /// Unicode code points of CP437 glyphs
+  /// for output into UTF-8 terminal.
+  ///
+  const uint16_t kCP437ToUnicode[256] =
   {
-    public:
-      static const int kAlignLeft   = 0;
-      static const int kAlignCenter = 1;
-      static const int kAlignRight  = 2;
+    0x0020, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022,
+    0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C,
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8,
+    0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302,
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+    0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+    0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+    0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+    0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F,
+    0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B,
+    0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4,
+    0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248,
+    0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
+  };
 
-      ~Printer()
-      {
-        #ifdef USE_SDL
-        for (auto& i : _images)
-        {
-          SDL_DestroyTexture(i);
-        }
-        #endif
-      }
+  // ===========================================================================
 
-#ifdef USE_SDL
-      /// @param[in] renderer Reference to SDL_Renderer.
-      /// @param[in] fontImageFilename Font image filename.
-      /// @param[in] charImageWidth Font tileset char width in pixels.
-      /// @param[in] charImageHeight Font tileset char height in pixels.
-      /// @param[in] windowWidth Window created width for framebuffer dimensions calculation.
-      /// @param[in] windowHeight Window created height for framebuffer dimensions calculation.
-      /// @param[in] globalScale Optional parameter to scale the drawn font.
-      bool Init(SDL_Renderer* renderer,
-                const std::string& fontImageFilename,
-                int charImageWidth,
-                int charImageHeight,
-                int windowWidth,
-                int windowHeight,
-                float globalScale = 1.0f)
-      {
-        if (_initialized)
-        {
-          printf("%s - already initialized!\n", __PRETTY_FUNCTION__);
-          return _initialized;
-        }
+  ///
+  /// Embedded 8x16 font, 256 CP437 glyphs, 16 bytes per glyph.
+  /// One byte per row, most significant bit is the leftmost pixel.
+  ///
+  constexpr uint8_t kTileset8x16[256 * 16] =
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x00
+    0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81, 0x81, 0xBD, 0x99, 0x81, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, // 0x01
+    0x00, 0x00, 0x7E, 0xFF, 0xDB, 0xFF, 0xFF, 0xC3, 0xE7, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, // 0x02
+    0x00, 0x00, 0x00, 0x00, 0x6C, 0xFE, 0xFE, 0xFE, 0xFE, 0x7C, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, // 0x03
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7C, 0xFE, 0x7C, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x04
+    0x00, 0x00, 0x00, 0x18, 0x3C, 0x3C, 0xE7, 0xE7, 0xE7, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x05
+    0x00, 0x00, 0x00, 0x18, 0x3C, 0x7E, 0xFF, 0xFF, 0x7E, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x06
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3C, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x07
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xC3, 0xC3, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // 0x08
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x09
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x99, 0xBD, 0xBD, 0x99, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // 0x0A
+    0x00, 0x00, 0x1E, 0x0E, 0x1A, 0x32, 0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0x00, 0x00, 0x00, 0x00, // 0x0B
+    0x00, 0x00, 0x3C, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x18, 0x7E, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x0C
+    0x00, 0x00, 0x3F, 0x33, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x70, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, // 0x0D
+    0x00, 0x00, 0x7F, 0x63, 0x7F, 0x63, 0x63, 0x63, 0x63, 0x67, 0xE7, 0xE6, 0xC0, 0x00, 0x00, 0x00, // 0x0E
+    0x00, 0x00, 0x00, 0x18, 0x18, 0xDB, 0x3C, 0xE7, 0x3C, 0xDB, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x0F
+    0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFE, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, // 0x10
+    0x00, 0x02, 0x06, 0x0E, 0x1E, 0x3E, 0xFE, 0x3E, 0x1E, 0x0E, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, // 0x11
+    0x00, 0x00, 0x18, 0x3C, 0x7E, 0x18, 0x18, 0x18, 0x7E, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x12
+    0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, // 0x13
+    0x00, 0x00, 0x7F, 0xDB, 0xDB, 0xDB, 0x7B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x00, 0x00, 0x00, 0x00, // 0x14
+    0x00, 0x7C, 0xC6, 0x60, 0x38, 0x6C, 0xC6, 0xC6, 0x6C, 0x38, 0x0C, 0xC6, 0x7C, 0x00, 0x00, 0x00, // 0x15
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, // 0x16
+    0x00, 0x00, 0x18, 0x3C, 0x7E, 0x18, 0x18, 0x18, 0x7E, 0x3C, 0x18, 0x7E, 0x00, 0x00, 0x00, 0x00, // 0x17
+    0x00, 0x00, 0x18, 0x3C, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x18
+    0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x19
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0xFE, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0xFE, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x66, 0xFF, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1D
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x38, 0x7C, 0x7C, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1E
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x7C, 0x7C, 0x38, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x20
+    0x00, 0x00, 0x18, 0x3C, 0x3C, 0x3C, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x21
+    0x00, 0x66, 0x66, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x22
+    0x00, 0x00, 0x00, 0x6C, 0x6C, 0xFE, 0x6C, 0x6C, 0x6C, 0xFE, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, // 0x23
+    0x18, 0x18, 0x7C, 0xC6, 0xC2, 0xC0, 0x7C, 0x06, 0x06, 0x86, 0xC6, 0x7C, 0x18, 0x18, 0x00, 0x00, // 0x24
+    0x00, 0x00, 0x00, 0x00, 0xC2, 0xC6, 0x0C, 0x18, 0x30, 0x60, 0xC6, 0x86, 0x00, 0x00, 0x00, 0x00, // 0x25
+    0x00, 0x00, 0x38, 0x6C, 0x6C, 0x38, 0x76, 0xDC, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x26
+    0x00, 0x30, 0x30, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x27
+    0x00, 0x00, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, // 0x28
+    0x00, 0x00, 0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, // 0x29
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x2A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x2B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, // 0x2C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x2D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x2E
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, // 0x2F
+    0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xCE, 0xDE, 0xF6, 0xE6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x30
+    0x00, 0x00, 0x18, 0x38, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x00, 0x00, 0x00, // 0x31
+    0x00, 0x00, 0x7C, 0xC6, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xC6, 0xFE, 0x00, 0x00, 0x00, 0x00, // 0x32
+    0x00, 0x00, 0x7C, 0xC6, 0x06, 0x06, 0x3C, 0x06, 0x06, 0x06, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x33
+    0x00, 0x00, 0x0C, 0x1C, 0x3C, 0x6C, 0xCC, 0xFE, 0x0C, 0x0C, 0x0C, 0x1E, 0x00, 0x00, 0x00, 0x00, // 0x34
+    0x00, 0x00, 0xFE, 0xC0, 0xC0, 0xC0, 0xFC, 0x06, 0x06, 0x06, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x35
+    0x00, 0x00, 0x38, 0x60, 0xC0, 0xC0, 0xFC, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x36
+    0x00, 0x00, 0xFE, 0xC6, 0x06, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, // 0x37
+    0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x38
+    0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0x06, 0x06, 0x0C, 0x78, 0x00, 0x00, 0x00, 0x00, // 0x39
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x3A
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, // 0x3B
+    0x00, 0x00, 0x00, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x00, 0x00, 0x00, 0x00, // 0x3C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x3D
+    0x00, 0x00, 0x00, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, // 0x3E
+    0x00, 0x00, 0x7C, 0xC6, 0xC6, 0x0C, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x3F
+    0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0xDE, 0xDE, 0xDE, 0xDC, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x40
+    0x00, 0x00, 0x10, 0x38, 0x6C, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0x00, 0x00, 0x00, // 0x41
+    0x00, 0x00, 0xFC, 0x66, 0x66, 0x66, 0x7C, 0x66, 0x66, 0x66, 0x66, 0xFC, 0x00, 0x00, 0x00, 0x00, // 0x42
+    0x00, 0x00, 0x3C, 0x66, 0xC2, 0xC0, 0xC0, 0xC0, 0xC0, 0xC2, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x43
+    0x00, 0x00, 0xF8, 0x6C, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6C, 0xF8, 0x00, 0x00, 0x00, 0x00, // 0x44
+    0x00, 0x00, 0xFE, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xFE, 0x00, 0x00, 0x00, 0x00, // 0x45
+    0x00, 0x00, 0xFE, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x60, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00, // 0x46
+    0x00, 0x00, 0x3C, 0x66, 0xC2, 0xC0, 0xC0, 0xDE, 0xC6, 0xC6, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00, // 0x47
+    0x00, 0x00, 0xC6, 0xC6, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0x00, 0x00, 0x00, // 0x48
+    0x00, 0x00, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x49
+    0x00, 0x00, 0x1E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0xCC, 0x78, 0x00, 0x00, 0x00, 0x00, // 0x4A
+    0x00, 0x00, 0xE6, 0x66, 0x66, 0x6C, 0x78, 0x78, 0x6C, 0x66, 0x66, 0xE6, 0x00, 0x00, 0x00, 0x00, // 0x4B
+    0x00, 0x00, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x66, 0xFE, 0x00, 0x00, 0x00, 0x00, // 0x4C
+    0x00, 0x00, 0xC3, 0xE7, 0xFF, 0xFF, 0xDB, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x00, 0x00, 0x00, 0x00, // 0x4D
+    0x00, 0x00, 0xC6, 0xE6, 0xF6, 0xFE, 0xDE, 0xCE, 0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0x00, 0x00, 0x00, // 0x4E
+    0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x4F
+    0x00, 0x00, 0xFC, 0x66, 0x66, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00, // 0x50
+    0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xD6, 0xDE, 0x7C, 0x0C, 0x0E, 0x00, 0x00, // 0x51
+    0x00, 0x00, 0xFC, 0x66, 0x66, 0x66, 0x7C, 0x6C, 0x66, 0x66, 0x66, 0xE6, 0x00, 0x00, 0x00, 0x00, // 0x52
+    0x00, 0x00, 0x7C, 0xC6, 0xC6, 0x60, 0x38, 0x0C, 0x06, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x53
+    0x00, 0x00, 0xFF, 0xDB, 0x99, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x54
+    0x00, 0x00, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x55
+    0x00, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x56
+    0x00, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xDB, 0xDB, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, // 0x57
+    0x00, 0x00, 0xC3, 0xC3, 0x66, 0x3C, 0x18, 0x18, 0x3C, 0x66, 0xC3, 0xC3, 0x00, 0x00, 0x00, 0x00, // 0x58
+    0x00, 0x00, 0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x59
+    0x00, 0x00, 0xFF, 0xC3, 0x86, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x00, // 0x5A
+    0x00, 0x00, 0x3C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x5B
+    0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, // 0x5C
+    0x00, 0x00, 0x3C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x5D
+    0x10, 0x38, 0x6C, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x5E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, // 0x5F
+    0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x60
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x61
+    0x00, 0x00, 0xE0, 0x60, 0x60, 0x78, 0x6C, 0x66, 0x66, 0x66, 0x66, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x62
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC6, 0xC0, 0xC0, 0xC0, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x63
+    0x00, 0x00, 0x1C, 0x0C, 0x0C, 0x3C, 0x6C, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x64
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC6, 0xFE, 0xC0, 0xC0, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x65
+    0x00, 0x00, 0x38, 0x6C, 0x64, 0x60, 0xF0, 0x60, 0x60, 0x60, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00, // 0x66
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0xCC, 0x78, 0x00, // 0x67
+    0x00, 0x00, 0xE0, 0x60, 0x60, 0x6C, 0x76, 0x66, 0x66, 0x66, 0x66, 0xE6, 0x00, 0x00, 0x00, 0x00, // 0x68
+    0x00, 0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x69
+    0x00, 0x00, 0x06, 0x06, 0x00, 0x0E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x3C, 0x00, // 0x6A
+    0x00, 0x00, 0xE0, 0x60, 0x60, 0x66, 0x6C, 0x78, 0x78, 0x6C, 0x66, 0xE6, 0x00, 0x00, 0x00, 0x00, // 0x6B
+    0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x6C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0x00, 0x00, 0x00, 0x00, // 0x6D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, // 0x6E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x6F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7C, 0x60, 0x60, 0xF0, 0x00, // 0x70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0x0C, 0x1E, 0x00, // 0x71
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x76, 0x66, 0x60, 0x60, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00, // 0x72
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC6, 0x60, 0x38, 0x0C, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x73
+    0x00, 0x00, 0x10, 0x30, 0x30, 0xFC, 0x30, 0x30, 0x30, 0x30, 0x36, 0x1C, 0x00, 0x00, 0x00, 0x00, // 0x74
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x75
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0x66, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x76
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xC3, 0xC3, 0xDB, 0xDB, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, // 0x77
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x66, 0x3C, 0x18, 0x3C, 0x66, 0xC3, 0x00, 0x00, 0x00, 0x00, // 0x78
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0x0C, 0xF8, 0x00, // 0x79
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xCC, 0x18, 0x30, 0x60, 0xC6, 0xFE, 0x00, 0x00, 0x00, 0x00, // 0x7A
+    0x00, 0x00, 0x0E, 0x18, 0x18, 0x18, 0x70, 0x18, 0x18, 0x18, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x00, // 0x7B
+    0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x7C
+    0x00, 0x00, 0x70, 0x18, 0x18, 0x18, 0x0E, 0x18, 0x18, 0x18, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, // 0x7D
+    0x00, 0x00, 0x76, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x7E
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x6C, 0xC6, 0xC6, 0xC6, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x7F
+    0x00, 0x00, 0x3C, 0x66, 0xC2, 0xC0, 0xC0, 0xC0, 0xC2, 0x66, 0x3C, 0x0C, 0x06, 0x7C, 0x00, 0x00, // 0x80
+    0x00, 0x00, 0xCC, 0x00, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x81
+    0x00, 0x0C, 0x18, 0x30, 0x00, 0x7C, 0xC6, 0xFE, 0xC0, 0xC0, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x82
+    0x00, 0x10, 0x38, 0x6C, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x83
+    0x00, 0x00, 0xCC, 0x00, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x84
+    0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x85
+    0x00, 0x38, 0x6C, 0x38, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x86
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0x66, 0x60, 0x60, 0x66, 0x3C, 0x0C, 0x06, 0x3C, 0x00, 0x00, 0x00, // 0x87
+    0x00, 0x10, 0x38, 0x6C, 0x00, 0x7C, 0xC6, 0xFE, 0xC0, 0xC0, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x88
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x7C, 0xC6, 0xFE, 0xC0, 0xC0, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x89
+    0x00, 0x60, 0x30, 0x18, 0x00, 0x7C, 0xC6, 0xFE, 0xC0, 0xC0, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x8A
+    0x00, 0x00, 0x66, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x8B
+    0x00, 0x18, 0x3C, 0x66, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x8C
+    0x00, 0x60, 0x30, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0x8D
+    0x00, 0xC6, 0x00, 0x10, 0x38, 0x6C, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0x00, 0x00, 0x00, 0x00, // 0x8E
+    0x38, 0x6C, 0x38, 0x00, 0x38, 0x6C, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0x00, 0x00, 0x00, 0x00, // 0x8F
+    0x18, 0x30, 0x60, 0x00, 0xFE, 0x66, 0x60, 0x7C, 0x60, 0x60, 0x66, 0xFE, 0x00, 0x00, 0x00, 0x00, // 0x90
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x3B, 0x1B, 0x7E, 0xD8, 0xDC, 0x77, 0x00, 0x00, 0x00, 0x00, // 0x91
+    0x00, 0x00, 0x3E, 0x6C, 0xCC, 0xCC, 0xFE, 0xCC, 0xCC, 0xCC, 0xCC, 0xCE, 0x00, 0x00, 0x00, 0x00, // 0x92
+    0x00, 0x10, 0x38, 0x6C, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x93
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x94
+    0x00, 0x60, 0x30, 0x18, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x95
+    0x00, 0x30, 0x78, 0xCC, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x96
+    0x00, 0x60, 0x30, 0x18, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0x97
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0x0C, 0x78, 0x00, // 0x98
+    0x00, 0xC6, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x99
+    0x00, 0xC6, 0x00, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0x9A
+    0x00, 0x18, 0x18, 0x7E, 0xC3, 0xC0, 0xC0, 0xC0, 0xC3, 0x7E, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x9B
+    0x00, 0x38, 0x6C, 0x64, 0x60, 0xF0, 0x60, 0x60, 0x60, 0x60, 0xE6, 0xFC, 0x00, 0x00, 0x00, 0x00, // 0x9C
+    0x00, 0x00, 0xC3, 0x66, 0x3C, 0x18, 0xFF, 0x18, 0xFF, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // 0x9D
+    0x00, 0xFC, 0x66, 0x66, 0x7C, 0x62, 0x66, 0x6F, 0x66, 0x66, 0x66, 0xF3, 0x00, 0x00, 0x00, 0x00, // 0x9E
+    0x00, 0x0E, 0x1B, 0x18, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0xD8, 0x70, 0x00, 0x00, // 0x9F
+    0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0xA0
+    0x00, 0x0C, 0x18, 0x30, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0xA1
+    0x00, 0x18, 0x30, 0x60, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0xA2
+    0x00, 0x18, 0x30, 0x60, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0xA3
+    0x00, 0x00, 0x76, 0xDC, 0x00, 0xDC, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, // 0xA4
+    0x76, 0xDC, 0x00, 0xC6, 0xE6, 0xF6, 0xFE, 0xDE, 0xCE, 0xC6, 0xC6, 0xC6, 0x00, 0x00, 0x00, 0x00, // 0xA5
+    0x00, 0x3C, 0x6C, 0x6C, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xA6
+    0x00, 0x38, 0x6C, 0x6C, 0x38, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xA7
+    0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0xC0, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, // 0xA8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xA9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xAA
+    0x00, 0xC0, 0xC0, 0xC2, 0xC6, 0xCC, 0x18, 0x30, 0x60, 0xCE, 0x9B, 0x06, 0x0C, 0x1F, 0x00, 0x00, // 0xAB
+    0x00, 0xC0, 0xC0, 0xC2, 0xC6, 0xCC, 0x18, 0x30, 0x66, 0xCE, 0x96, 0x3E, 0x06, 0x06, 0x00, 0x00, // 0xAC
+    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x3C, 0x3C, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x00, // 0xAD
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x6C, 0xD8, 0x6C, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xAE
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x6C, 0x36, 0x6C, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xAF
+    0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, // 0xB0
+    0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, // 0xB1
+    0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, 0xDD, 0x77, // 0xB2
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xB3
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xB4
+    0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xB5
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xF6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xB6
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xB7
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xB8
+    0x36, 0x36, 0x36, 0x36, 0x36, 0xF6, 0x06, 0xF6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xB9
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xBA
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x06, 0xF6, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xBB
+    0x36, 0x36, 0x36, 0x36, 0x36, 0xF6, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xBC
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xBD
+    0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0x18, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xBE
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xBF
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC0
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC1
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xC2
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xC3
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC4
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xC5
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xC6
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xC7
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xC9
+    0x36, 0x36, 0x36, 0x36, 0x36, 0xF7, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xCA
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xF7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xCB
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xCC
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xCD
+    0x36, 0x36, 0x36, 0x36, 0x36, 0xF7, 0x00, 0xF7, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xCE
+    0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xCF
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xD1
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xD2
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD3
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD4
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x18, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xD5
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xD6
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xFF, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, // 0xD7
+    0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x18, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xD8
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xDA
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // 0xDB
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // 0xDC
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, // 0xDD
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, // 0xDE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xDF
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xDC, 0xD8, 0xD8, 0xD8, 0xDC, 0x76, 0x00, 0x00, 0x00, 0x00, // 0xE0
+    0x00, 0x00, 0x78, 0xCC, 0xCC, 0xCC, 0xD8, 0xCC, 0xC6, 0xC6, 0xC6, 0xCC, 0x00, 0x00, 0x00, 0x00, // 0xE1
+    0x00, 0x00, 0xFE, 0xC6, 0xC6, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, // 0xE2
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, // 0xE3
+    0x00, 0x00, 0x00, 0xFE, 0xC6, 0x60, 0x30, 0x18, 0x30, 0x60, 0xC6, 0xFE, 0x00, 0x00, 0x00, 0x00, // 0xE4
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0x70, 0x00, 0x00, 0x00, 0x00, // 0xE5
+    0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7C, 0x60, 0x60, 0xC0, 0x00, 0x00, 0x00, // 0xE6
+    0x00, 0x00, 0x00, 0x00, 0x76, 0xDC, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // 0xE7
+    0x00, 0x00, 0x00, 0x7E, 0x18, 0x3C, 0x66, 0x66, 0x66, 0x3C, 0x18, 0x7E, 0x00, 0x00, 0x00, 0x00, // 0xE8
+    0x00, 0x00, 0x00, 0x38, 0x6C, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0x6C, 0x38, 0x00, 0x00, 0x00, 0x00, // 0xE9
+    0x00, 0x00, 0x38, 0x6C, 0xC6, 0xC6, 0xC6, 0x6C, 0x6C, 0x6C, 0x6C, 0xEE, 0x00, 0x00, 0x00, 0x00, // 0xEA
+    0x00, 0x00, 0x1E, 0x30, 0x18, 0x0C, 0x3E, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00, // 0xEB
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xDB, 0xDB, 0xDB, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xEC
+    0x00, 0x00, 0x00, 0x03, 0x06, 0x7E, 0xDB, 0xDB, 0xF3, 0x7E, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, // 0xED
+    0x00, 0x00, 0x1C, 0x30, 0x60, 0x60, 0x7C, 0x60, 0x60, 0x60, 0x30, 0x1C, 0x00, 0x00, 0x00, 0x00, // 0xEE
+    0x00, 0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0x00, 0x00, 0x00, // 0xEF
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xF0
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, // 0xF1
+    0x00, 0x00, 0x00, 0x30, 0x18, 0x0C, 0x06, 0x0C, 0x18, 0x30, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, // 0xF2
+    0x00, 0x00, 0x00, 0x0C, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0C, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, // 0xF3
+    0x00, 0x00, 0x0E, 0x1B, 0x1B, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, // 0xF4
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xD8, 0xD8, 0xD8, 0x70, 0x00, 0x00, 0x00, 0x00, // 0xF5
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x7E, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xF6
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xDC, 0x00, 0x76, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xF7
+    0x00, 0x38, 0x6C, 0x6C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xF8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xF9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xFA
+    0x00, 0x0F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xEC, 0x6C, 0x6C, 0x3C, 0x1C, 0x00, 0x00, 0x00, 0x00, // 0xFB
+    0x00, 0xD8, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xFC
+    0x00, 0x70, 0xD8, 0x30, 0x60, 0xC8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xFD
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xFE
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  // 0xFF
+  };
 
-        _rendererRef     = renderer;
-        _tilesetFilename = fontImageFilename;
-        _tileWidth       = charImageWidth;
-        _tileHeight      = charImageHeight;
-        _globalScale     = globalScale;
-        _windowWidth     = windowWidth;
-        _windowHeight    = windowHeight;
+  // ===========================================================================
 
-        if (InitForSDL(false))
-        {
-          _initialized = true;
-        }
+  ///
+  /// Image or sprite draw of a recorded frame (SDL only).
+  /// Id refers to FramePlayer::ImageSource().
+  ///
+  struct RecordedImage
+  {
+    int Id    = 0;
+    int X     = 0;
+    int Y     = 0;
+    int W     = 0;
+    int H     = 0;
+    int Angle = 0;
+    int Flip  = 0;
+
+    // Sprites only
+    int Z         = 0;
+    uint32_t Tint = 0xFFFFFF;
+  };
 
-        return _initialized;
+  // ===========================================================================
+
+  //
+  // Recording is "TGR2" followed by records that start with type byte:
+  //
+  // 'K' - keyframe: time, width, height, cells, images, sprites
+  // 'D' - delta: time, cells XOR'ed with the previous frame, images, sprites
+  // 'S' - same cells as the previous frame: time, images, sprites
+  // 'I' - image source: id, filename length, filename, color key
+  //
+  // Time is microseconds since the previous frame. Cells are 64 bit
+  // FBPixels in runs of (length << 1 | 1, value) or (length << 1, values).
+  // Images are count, then id, x, y, w, h, angle, flip of each,
+  // sprites the same with z and tint added.
+  // Other numbers are LEB128 varints, signed ones zigzag encoded.
+  //
+  const char kRecordingMagic[] = "TGR2";
+
+  // ===========================================================================
+
+  ///
+  /// Writes every frame passed to Printer::SetRecorder()'s printer.
+  /// Static screens cost a couple of bytes per frame.
+  ///
+  class FrameRecorder
+  {
+    public:
+      ~FrameRecorder()
+      {
+        Close();
       }
 
       // =======================================================================
 
-      bool Init(SDL_Renderer* renderer,
-                int windowWidth,
-                int windowHeight,
-                float globalScale = 1.0f)
+      /// @param[in] keyframeInterval Every keyframeInterval-th frame
+      ///                             is stored whole, so that one
+      ///                             corrupted delta doesn't ruin the rest.
+      bool Open(const std::string& fname, int keyframeInterval = 1800)
       {
-        if (_initialized)
+        Close();
+
+        _file = fopen(fname.data(), "wb");
+        if (_file == nullptr)
         {
-          printf("%s - already initialized!\n", __PRETTY_FUNCTION__);
-          return _initialized;
+          printf("%s - can't open %s: %s\n",
+                 __PRETTY_FUNCTION__,
+                 fname.data(),
+                 strerror(errno));
+          return false;
         }
 
-        _rendererRef = renderer;
-        _tileWidth = 8;
-        _tileHeight = 16;
-        _globalScale = globalScale;
-        _windowWidth = windowWidth;
-        _windowHeight = windowHeight;
+        _bytesWritten = 0;
 
-        if (InitForSDL(true))
+        if (fwrite(kRecordingMagic, 1, 4, _file) != 4)
         {
-          _initialized = true;
+          printf("%s - can't write %s: %s\n",
+                 __PRETTY_FUNCTION__,
+                 fname.data(),
+                 strerror(errno));
+          Close();
+          return false;
         }
 
-        return _initialized;
-      }
-      #else
-      void Init()
-      {
-        InitForCurses();
+        _keyframeInterval = std::max(keyframeInterval, 1);
+        _sinceKeyframe    = 0;
+        _bytesWritten     = 4;
+
+        _prev.clear();
+        _imageIds.clear();
+        _images.clear();
+        _sprites.clear();
+        _out.clear();
+
+        return true;
       }
-      #endif
 
       // =======================================================================
 
-      /// Clears framebuffer (ncurses) or renderer (SDL)
-      /// Use this before all PrintFB calls
-      void Clear()
+      void Close()
       {
-  #ifndef USE_SDL
-        for (int x = 0; x < _terminalWidth; x++)
+        if (_file != nullptr)
         {
-          for (int y = 0; y < _terminalHeight; y++)
-          {
-            PrintFB(x, y, ' ', Colors::Black, Colors::Black);
-          }
+          fclose(_file);
+          _file = nullptr;
         }
-  #else
-        SDL_SetRenderTarget(_rendererRef, _frameBuffer);
-        SDL_RenderClear(_rendererRef);
-  #endif
       }
 
       // =======================================================================
 
-      /// Prints framebuffer contents to the screen
-      /// Call this after all PrintFB calls
-      void Render()
+      bool IsOpen() const { return (_file != nullptr); }
+
+      size_t BytesWritten() const { return _bytesWritten; }
+
+      // =======================================================================
+
+      /// Printer calls it for every DrawImage() with image handle.
+      void AddImage(const std::string& fname,
+                    uint32_t colorKey,
+                    int x,
+                    int y,
+                    int w,
+                    int h,
+                    int angle,
+                    int flip)
       {
-  #ifndef USE_SDL
-        for (int x = 0; x < _terminalWidth; x++)
+        if (_file == nullptr)
         {
-          for (int y = 0; y < _terminalHeight; y++)
-          {
-            attron(COLOR_PAIR(_colorMap[_frameBuffer[x][y].ColorPairHash].PairIndex));
-            mvaddch(y, x, _frameBuffer[x][y].Character);
-            attroff(COLOR_PAIR(_colorMap[_frameBuffer[x][y].ColorPairHash].PairIndex));
-          }
+          return;
         }
 
-        refresh();
-  #else
-        SDL_SetRenderTarget(_rendererRef, nullptr);
-        SDL_RenderClear(_rendererRef);
-        SDL_RenderCopy(_rendererRef, _frameBuffer, nullptr, nullptr);
-        SDL_RenderPresent(_rendererRef);
-  #endif
+        RecordedImage img;
+
+        img.Id    = ImageId(fname, colorKey);
+        img.X     = x;
+        img.Y     = y;
+        img.W     = w;
+        img.H     = h;
+        img.Angle = angle;
+        img.Flip  = flip;
+
+        _images.push_back(img);
       }
 
       // =======================================================================
 
-      int TerminalWidth()  { return _terminalWidth;  }
-      int TerminalHeight() { return _terminalHeight; }
+      /// Printer calls it for every DrawSprite() that was accepted.
+      void AddSprite(const std::string& fname,
+                     uint32_t colorKey,
+                     int x,
+                     int y,
+                     int w,
+                     int h,
+                     int angle,
+                     int flip,
+                     int z,
+                     uint32_t tint)
+      {
+        if (_file == nullptr)
+        {
+          return;
+        }
+
+        RecordedImage img;
+
+        img.Id    = ImageId(fname, colorKey);
+        img.X     = x;
+        img.Y     = y;
+        img.W     = w;
+        img.H     = h;
+        img.Angle = angle;
+        img.Flip  = flip;
+        img.Z     = z;
+        img.Tint  = tint;
+
+        _sprites.push_back(img);
+      }
 
       // =======================================================================
 
-  #ifndef USE_SDL
-      /// Print to "framebuffer"
-      void PrintFB(const int& x,
-                   const int& y,
-                   const int& ch,
-                   const uint32_t& htmlColorFg,
-                   const uint32_t& htmlColorBg = Colors::Black)
+      /// Printer calls it at the end of every Render().
+      void AddFrame(const std::vector<FBPixel>& frame, int width, int height)
       {
-        if (x < 0 || x > _terminalWidth - 1
-         || y < 0 || y > _terminalHeight - 1)
+        if (_file == nullptr)
         {
           return;
         }
 
-        // Black & White mode for Windows
-        // due to PDCurses not handling colors correctly
+        auto now = std::chrono::steady_clock::now();
 
-        #if !(defined(__unix__) || defined(__linux__))
-        uint32_t tmpFg;
-        uint32_t tmpBg;
-
-        if (htmlColorFg == Colors::Black
-        and htmlColorBg == Colors::Black)
+        uint64_t time = 0;
+        if (not _prev.empty())
         {
-          tmpFg = Colors::Black;
-          tmpBg = Colors::Black;
+          time = std::chrono::duration_cast<std::chrono::microseconds>(
+                   now - _lastFrameTime).count();
         }
-        else if (htmlColorBg != Colors::Black)
+
+        _lastFrameTime = now;
+
+        size_t cells = (size_t)width * height;
+
+        _cur.resize(cells);
+        memcpy(_cur.data(), frame.data(), cells * sizeof(uint64_t));
+
+        bool keyframe = (_prev.size() != cells
+                      || width != _width
+                      || _sinceKeyframe >= _keyframeInterval);
+
+        if (keyframe)
         {
-          tmpFg = Colors::Black;
-          tmpBg = Colors::White;
+          _out.push_back('K');
+          PutVarint(time);
+          PutVarint(width);
+          PutVarint(height);
+          PutCells(_cur.data(), cells);
+
+          _width         = width;
+          _sinceKeyframe = 0;
         }
         else
         {
-          tmpFg = Colors::White;
-          tmpBg = Colors::Black;
+          bool changed = false;
+
+          for (size_t i = 0; i < cells; i++)
+          {
+            _prev[i] ^= _cur[i];
+            changed |= (_prev[i] != 0);
+          }
+
+          if (changed)
+          {
+            _out.push_back('D');
+            PutVarint(time);
+            PutCells(_prev.data(), cells);
+          }
+          else
+          {
+            _out.push_back('S');
+            PutVarint(time);
+          }
+        }
+
+        PutVarint(_images.size());
+
+        for (const RecordedImage& img : _images)
+        {
+          PutImage(img);
         }
 
-        size_t hash = GetOrSetColor(tmpFg, tmpBg);
-        #else
-        size_t hash = GetOrSetColor(htmlColorFg, htmlColorBg);
-        #endif
+        PutVarint(_sprites.size());
+
+        for (const RecordedImage& img : _sprites)
+        {
+          PutImage(img);
+          PutSigned(img.Z);
+          PutVarint(img.Tint);
+        }
 
-        _frameBuffer[x][y].Character = ch;
-        _frameBuffer[x][y].ColorPairHash = hash;
+        _images.clear();
+        _sprites.clear();
+
+        _prev.swap(_cur);
+        _sinceKeyframe++;
+
+        if (fwrite(_out.data(), 1, _out.size(), _file) != _out.size())
+        {
+          printf("%s - write failed, recording stopped: %s\n",
+                 __PRETTY_FUNCTION__,
+                 strerror(errno));
+          Close();
+        }
+        else
+        {
+          _bytesWritten += _out.size();
+        }
+
+        _out.clear();
       }
 
       // =======================================================================
 
-      void PrintFB(const int& x,
-                   const int& y,
-                   const std::string& text,
-                   int align,
-                   const uint32_t& htmlColorFg,
-                   const uint32_t& htmlColorBg = Colors::Black)
+    private:
+      //
+      // Writes image source record the first time it's seen.
+      //
+      int ImageId(const std::string& fname, uint32_t colorKey)
       {
-        auto textPos = AlignText(x, y, align, text);
+        auto key = std::make_pair(fname, colorKey);
 
-        int xOffset = 0;
-        for (auto& c : text)
+        auto found = _imageIds.find(key);
+        if (found == _imageIds.end())
         {
-          //
-          // Coordinates are swapped because
-          // in framebuffer we don't work in ncurses
-          // coordinate system.
-          //
-          PrintFB(textPos.second + xOffset,
-                  textPos.first,
-                  c,
-                  htmlColorFg,
-                  htmlColorBg);
+          int id = (int)_imageIds.size();
+
+          found = _imageIds.emplace(key, id).first;
 
-          xOffset++;
+          _out.push_back('I');
+          PutVarint(id);
+          PutVarint(fname.length());
+          _out.insert(_out.end(), fname.begin(), fname.end());
+          PutVarint(colorKey);
         }
+
+        return found->second;
       }
 
       // =======================================================================
 
-      void DrawWindow(const Position& leftCorner,
-                      const Position& size,
-                      const std::string& header = std::string{},
-                      const uint32_t& headerFgColor = Colors::White,
-                      const uint32_t& headerBgColor = Colors::Black,
-                      const uint32_t& borderColor = Colors::White,
-                      const uint32_t& borderBgColor = Colors::Black,
-                      const uint32_t& bgColor = Colors::Black)
+      void PutVarint(uint64_t value)
       {
-        int x = leftCorner.X;
-        int y = leftCorner.Y;
+        while (value >= 0x80)
+        {
+          _out.push_back((uint8_t)(value | 0x80));
+          value >>= 7;
+        }
+
+        _out.push_back((uint8_t)value);
+      }
+
+      // =======================================================================
+
+      void PutSigned(int64_t value)
+      {
+        PutVarint(((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+      }
+
+      // =======================================================================
+
+      void PutImage(const RecordedImage& img)
+      {
+        PutVarint(img.Id);
+        PutSigned(img.X);
+        PutSigned(img.Y);
+        PutSigned(img.W);
+        PutSigned(img.H);
+        PutSigned(img.Angle);
+        PutVarint(img.Flip);
+      }
+
+      // =======================================================================
 
-        // Fill background
+      void PutWords(const uint64_t* words, size_t count)
+      {
+        const uint8_t* bytes = (const uint8_t*)words;
+        _out.insert(_out.end(), bytes, bytes + count * sizeof(uint64_t));
+      }
+
+      // =======================================================================
+
+      //
+      // Runs shorter than kMinRun are cheaper as literals.
+      //
+      void PutCells(const uint64_t* words, size_t count)
+      {
+        const size_t kMinRun = 3;
 
-        for (int i = x + 1; i < x + size.X; i++)
+        size_t i = 0;
+
+        while (i < count)
         {
-          for (int j = y + 1; j < y + size.Y; j++)
+          size_t run = 1;
+          while (i + run < count && words[i + run] == words[i])
+          {
+            run++;
+          }
+
+          if (run >= kMinRun)
+          {
+            PutVarint((run << 1) | 1);
+            PutWords(words + i, 1);
+            i += run;
+            continue;
+          }
+
+          size_t start = i;
+
+          while (i < count)
           {
-            PrintFB(i, j, ' ', Colors::Black, bgColor);
+            run = 1;
+            while (i + run < count
+                && run < kMinRun
+                && words[i + run] == words[i])
+            {
+              run++;
+            }
+
+            if (run >= kMinRun)
+            {
+              break;
+            }
+
+            i += run;
           }
+
+          PutVarint((i - start) << 1);
+          PutWords(words + start, i - start);
         }
+      }
 
-        // Corners
+      // =======================================================================
 
-        PrintFB(x,          y, '+',          borderColor, borderBgColor);
-        PrintFB(x + size.X, y, '+',          borderColor, borderBgColor);
-        PrintFB(x,          y + size.Y, '+', borderColor, borderBgColor);
-        PrintFB(x + size.X, y + size.Y, '+', borderColor, borderBgColor);
+      FILE* _file = nullptr;
 
-        // Horizontal bars
+      int _keyframeInterval = 0;
+      int _sinceKeyframe    = 0;
+      int _width            = 0;
+
+      size_t _bytesWritten = 0;
+
+      std::chrono::steady_clock::time_point _lastFrameTime;
+
+      //
+      // Previous frame's cells, XOR'ed with current one
+      // in place while delta is being written.
+      //
+      std::vector<uint64_t> _prev;
+      std::vector<uint64_t> _cur;
+
+      std::vector<uint8_t> _out;
+
+      std::vector<RecordedImage> _images;
+      std::vector<RecordedImage> _sprites;
+
+      std::map<std::pair<std::string, uint32_t>, int> _imageIds;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Reads recording made by FrameRecorder,
+  /// see Printer::DrawRecordedFrame().
+  /// Whole file is loaded into memory, so replay
+  /// doesn't wait for disk.
+  ///
+  class FramePlayer
+  {
+    public:
+      ~FramePlayer()
+      {
+        Close();
+      }
+
+      // =======================================================================
+
+      bool Open(const std::string& fname)
+      {
+        Close();
 
-        for (int i = x + 1; i < x + size.X; i++)
+        FILE* f = fopen(fname.data(), "rb");
+        if (f == nullptr)
         {
-          PrintFB(i, y,          '-', borderColor, borderBgColor);
-          PrintFB(i, y + size.Y, '-', borderColor, borderBgColor);
+          printf("%s - can't open %s: %s\n",
+                 __PRETTY_FUNCTION__,
+                 fname.data(),
+                 strerror(errno));
+          return false;
         }
 
-        // Vertical bars
+        uint8_t buf[1 << 16];
 
-        for (int i = y + 1; i < y + size.Y; i++)
+        size_t read;
+        while ((read = fread(buf, 1, sizeof(buf), f)) > 0)
         {
-          PrintFB(x,          i, '|', borderColor, borderBgColor);
-          PrintFB(x + size.X, i, '|', borderColor, borderBgColor);
+          _data.insert(_data.end(), buf, buf + read);
         }
 
-        if (header.length() != 0)
+        fclose(f);
+
+        if (_data.size() < 4 || memcmp(_data.data(), kRecordingMagic, 4) != 0)
         {
-          std::string lHeader = header;
-          lHeader.insert(0, " ");
-          lHeader.append(" ");
+          printf("%s - %s is not a recording\n",
+                 __PRETTY_FUNCTION__,
+                 fname.data());
+          _data.clear();
+          return false;
+        }
 
-          int headerPosX = (x + (size.X / 2)) - lHeader.length() / 2;
-          int headerPosY = y;
+        Rewind();
 
-          for (auto& c : lHeader)
-          {
-            PrintFB(headerPosX, headerPosY, c, headerFgColor, headerBgColor);
+        return true;
+      }
+
+      // =======================================================================
 
-            headerPosX++;
+      /// Unloads images printer loaded for this recording,
+      /// so call it (or Open()) while that printer is still alive.
+      void Close()
+      {
+        for (int handle : _imageHandles)
+        {
+          if (handle != -1)
+          {
+            _unloadImage(handle);
           }
         }
+
+        _imageHandles.clear();
+        _unloadImage = nullptr;
+
+        _data.clear();
+        _sources.clear();
+
+        Rewind();
       }
-  #else
-      void PrintFB(const int& x,
-                   const int& y,
-                   int image,
-                   const uint32_t& htmlColorFg,
-                   const uint32_t& htmlColorBg = Colors::Black)
+
+      // =======================================================================
+
+      /// Image handles are kept, image sources
+      /// are read again along with the frames.
+      void Rewind()
       {
-        int posX = x * _tileWidthScaled;
-        int posY = y * _tileHeightScaled;
+        _pos        = 4;
+        _frameIndex = -1;
+        _width      = 0;
+        _height     = 0;
+        _frameTime  = 0;
+
+        _cells.clear();
+        _images.clear();
+        _sprites.clear();
+        _sources.clear();
+      }
+
+      // =======================================================================
+
+      /// Decodes next frame.
+      /// Returns false at the end of recording or if it's corrupted.
+      bool NextFrame()
+      {
+        _images.clear();
+        _sprites.clear();
+
+        while (_pos < _data.size())
+        {
+          uint8_t type = _data[_pos++];
+
+          bool ok = true;
+
+          switch (type)
+          {
+            case 'I':
+              ok = ReadImageSource();
+              break;
+
+            case 'K':
+            case 'D':
+            case 'S':
+              ok = ReadFrame(type);
+
+              if (ok)
+              {
+                _frameIndex++;
+                return true;
+              }
+
+              break;
+
+            default:
+              ok = false;
+              break;
+          }
+
+          if (not ok)
+          {
+            printf("%s - recording is corrupted at byte %zu\n",
+                   __PRETTY_FUNCTION__,
+                   _pos);
+            _pos = _data.size();
+            return false;
+          }
+        }
+
+        return false;
+      }
+
+      // =======================================================================
+
+      int Width()  const { return _width;  }
+      int Height() const { return _height; }
+
+      /// Index of the last decoded frame.
+      int FrameIndex() const { return _frameIndex; }
+
+      /// Microseconds between the last decoded frame and the one before it.
+      uint64_t FrameTime() const { return _frameTime; }
+
+      const std::vector<FBPixel>& Cells() const { return _cells; }
+
+      const std::vector<RecordedImage>& Images() const { return _images; }
+
+      /// Sprites of one frame, replayed as one batch.
+      const std::vector<RecordedImage>& Sprites() const { return _sprites; }
+
+      /// Filename and color key image id was loaded with.
+      const std::pair<std::string, uint32_t>& ImageSource(int id) const
+      {
+        return _sources[id];
+      }
+
+      // =======================================================================
+
+      /// Image handle of the printer this recording is played on,
+      /// -1 until printer loads it.
+      int& ImageHandle(int id)
+      {
+        if ((size_t)id >= _imageHandles.size())
+        {
+          _imageHandles.resize(id + 1, -1);
+        }
+
+        return _imageHandles[id];
+      }
+
+      // =======================================================================
+
+      /// Printer sets it when it loads image handles.
+      void SetImageUnloader(const std::function<void(int)>& unload)
+      {
+        _unloadImage = unload;
+      }
+
+      // =======================================================================
+
+    private:
+      bool GetVarint(uint64_t& value)
+      {
+        value = 0;
+
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+          if (_pos >= _data.size())
+          {
+            return false;
+          }
+
+          uint8_t b = _data[_pos++];
+
+          value |= (uint64_t)(b & 0x7F) << shift;
+
+          if ((b & 0x80) == 0)
+          {
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      // =======================================================================
+
+      bool GetInt(int& value)
+      {
+        uint64_t v;
+        if (not GetVarint(v))
+        {
+          return false;
+        }
+
+        value = (int)v;
+
+        return true;
+      }
+
+      // =======================================================================
+
+      bool GetSigned(int& value)
+      {
+        uint64_t v;
+        if (not GetVarint(v))
+        {
+          return false;
+        }
+
+        value = (int)((int64_t)(v >> 1) ^ -(int64_t)(v & 1));
+
+        return true;
+      }
+
+      // =======================================================================
+
+      bool GetWord(uint64_t& word)
+      {
+        if (_data.size() - _pos < sizeof(uint64_t))
+        {
+          return false;
+        }
+
+        memcpy(&word, _data.data() + _pos, sizeof(uint64_t));
+        _pos += sizeof(uint64_t);
+
+        return true;
+      }
+
+      // =======================================================================
+
+      //
+      // Keyframe overwrites cells, delta XORs them.
+      //
+      bool GetCells(bool keyframe)
+      {
+        uint64_t* words = (uint64_t*)_cells.data();
+        size_t count    = _cells.size();
+
+        size_t i = 0;
+
+        while (i < count)
+        {
+          uint64_t token;
+          if (not GetVarint(token))
+          {
+            return false;
+          }
+
+          size_t length = (size_t)(token >> 1);
+          if (length == 0 || length > count - i)
+          {
+            return false;
+          }
+
+          if (token & 1)
+          {
+            uint64_t value;
+            if (not GetWord(value))
+            {
+              return false;
+            }
+
+            for (size_t j = i; j < i + length; j++)
+            {
+              words[j] = keyframe ? value : (words[j] ^ value);
+            }
+          }
+          else
+          {
+            for (size_t j = i; j < i + length; j++)
+            {
+              uint64_t value;
+              if (not GetWord(value))
+              {
+                return false;
+              }
+
+              words[j] = keyframe ? value : (words[j] ^ value);
+            }
+          }
+
+          i += length;
+        }
+
+        return true;
+      }
+
+      // =======================================================================
+
+      bool ReadImageSource()
+      {
+        int id;
+        uint64_t length;
+
+        if (not GetInt(id)
+         || id != (int)_sources.size()
+         || not GetVarint(length)
+         || length > _data.size() - _pos)
+        {
+          return false;
+        }
+
+        std::string fname((const char*)_data.data() + _pos, length);
+        _pos += length;
+
+        uint64_t colorKey;
+        if (not GetVarint(colorKey))
+        {
+          return false;
+        }
+
+        _sources.emplace_back(fname, (uint32_t)colorKey);
+
+        return true;
+      }
+
+      // =======================================================================
+
+      bool ReadFrame(uint8_t type)
+      {
+        if (not GetVarint(_frameTime))
+        {
+          return false;
+        }
+
+        if (type == 'K')
+        {
+          if (not GetInt(_width)
+           || not GetInt(_height)
+           || _width <= 0
+           || _height <= 0
+           || (int64_t)_width * _height > kMaxCells)
+          {
+            return false;
+          }
+
+          _cells.resize((size_t)_width * _height);
+
+          if (not GetCells(true))
+          {
+            return false;
+          }
+        }
+        else if (_cells.empty())
+        {
+          //
+          // Delta before any keyframe.
+          //
+          return false;
+        }
+        else if (type == 'D' && not GetCells(false))
+        {
+          return false;
+        }
+
+        return (ReadImages(_images, false) && ReadImages(_sprites, true));
+      }
+
+      // =======================================================================
+
+      bool ReadImages(std::vector<RecordedImage>& images, bool sprites)
+      {
+        uint64_t count;
+        if (not GetVarint(count) || count > _data.size() - _pos)
+        {
+          return false;
+        }
+
+        for (uint64_t i = 0; i < count; i++)
+        {
+          RecordedImage img;
+
+          if (not GetInt(img.Id)
+           || (size_t)img.Id >= _sources.size()
+           || not GetSigned(img.X)
+           || not GetSigned(img.Y)
+           || not GetSigned(img.W)
+           || not GetSigned(img.H)
+           || not GetSigned(img.Angle)
+           || not GetInt(img.Flip))
+          {
+            return false;
+          }
+
+          if (sprites)
+          {
+            uint64_t tint;
+            if (not GetSigned(img.Z) || not GetVarint(tint))
+            {
+              return false;
+            }
+
+            img.Tint = (uint32_t)tint;
+          }
+
+          images.push_back(img);
+        }
+
+        return true;
+      }
+
+      // =======================================================================
+
+      //
+      // Corrupted size shouldn't allocate gigabytes.
+      //
+      static const int64_t kMaxCells = 1 << 24;
+
+      std::vector<uint8_t> _data;
+      size_t _pos = 0;
+
+      int _frameIndex = -1;
+      int _width      = 0;
+      int _height     = 0;
+
+      uint64_t _frameTime = 0;
+
+      std::vector<FBPixel> _cells;
+      std::vector<RecordedImage> _images;
+      std::vector<RecordedImage> _sprites;
+
+      std::vector<std::pair<std::string, uint32_t>> _sources;
+      std::vector<int> _imageHandles;
+
+      std::function<void(int)> _unloadImage;
+  };
+
+  // ===========================================================================
+
+#ifdef USE_CURSES
+  ///
+  /// Open addressing (linear probing) hash table that maps
+  /// packed (fg << 24 | bg) color key to ncurses color pair index.
+  /// Lookups don't allocate anything.
+  ///
+  class ColorPairTable
+  {
+    public:
+      ColorPairTable()
+      {
+        _slots.resize(kInitialCapacity);
+      }
+
+      // =======================================================================
+
+      /// Returns -1 if key is not present.
+      short Find(uint64_t key) const
+      {
+        size_t mask = _slots.size() - 1;
+        size_t i    = Hash(key) & mask;
+
+        while (_slots[i].Key != kEmptyKey)
+        {
+          if (_slots[i].Key == key)
+          {
+            return _slots[i].PairIndex;
+          }
+
+          i = (i + 1) & mask;
+        }
+
+        return -1;
+      }
+
+      // =======================================================================
+
+      void Insert(uint64_t key, short pairIndex)
+      {
+        //
+        // Keep load factor below 0.75
+        //
+        if ((_size + 1) * 4 > _slots.size() * 3)
+        {
+          Grow();
+        }
+
+        Place(key, pairIndex);
+
+        _size++;
+      }
+
+    private:
+      static const size_t kInitialCapacity = 256;
+      static const uint64_t kEmptyKey = 0xFFFFFFFFFFFFFFFF;
+
+      struct Slot
+      {
+        uint64_t Key    = kEmptyKey;
+        short PairIndex = -1;
+      };
+
+      std::vector<Slot> _slots;
+      size_t _size = 0;
+
+      // =======================================================================
+
+      static size_t Hash(uint64_t key)
+      {
+        key ^= (key >> 29);
+        key *= 0xBF58476D1CE4E5B9;
+        key ^= (key >> 32);
+
+        return (size_t)key;
+      }
+
+      // =======================================================================
+
+      void Place(uint64_t key, short pairIndex)
+      {
+        size_t mask = _slots.size() - 1;
+        size_t i    = Hash(key) & mask;
+
+        while (_slots[i].Key != kEmptyKey && _slots[i].Key != key)
+        {
+          i = (i + 1) & mask;
+        }
+
+        _slots[i].Key       = key;
+        _slots[i].PairIndex = pairIndex;
+      }
+
+      // =======================================================================
+
+      void Grow()
+      {
+        std::vector<Slot> old;
+        old.swap(_slots);
+
+        _slots.resize(old.size() * 2);
+
+        for (auto& slot : old)
+        {
+          if (slot.Key != kEmptyKey)
+          {
+            Place(slot.Key, slot.PairIndex);
+          }
+        }
+      }
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Output through ncurses.
+  ///
+  class CursesBackend
+  {
+    public:
+      static const bool kTransparentBlank = false;
+      static const bool kCP437Frames      = false;
+      static const bool kPixelHeader      = false;
+
+      //
+      // Black & White mode for Windows
+      // due to PDCurses not handling colors correctly
+      //
+      #if !(defined(__unix__) || defined(__linux__))
+      static const bool kBlackAndWhite = true;
+      #else
+      static const bool kBlackAndWhite = false;
+      #endif
+
+      /// ncurses must be already initialized with initscr()
+      /// and start_color().
+      bool Init()
+      {
+        int mx = 0;
+        int my = 0;
+
+        getmaxyx(stdscr, my, mx);
+
+        _terminalWidth = mx;
+        _terminalHeight = my;
+
+        // Enforce colors of standard ncurses colors
+        // because some colors aren't actually correspond to their
+        // "names", e.g. COLOR_BLACK isn't actually black, but grey,
+        // so we redefine it.
+
+        init_color(COLOR_BLACK, 0, 0, 0);
+        init_color(COLOR_WHITE, 1000, 1000, 1000);
+        init_color(COLOR_RED, 1000, 0, 0);
+        init_color(COLOR_GREEN, 0, 1000, 0);
+        init_color(COLOR_BLUE, 0, 0, 1000);
+        init_color(COLOR_CYAN, 0, 1000, 1000);
+        init_color(COLOR_MAGENTA, 1000, 0, 1000);
+        init_color(COLOR_YELLOW, 1000, 1000, 0);
+
+        _runBuffer.resize(_terminalWidth);
+
+        return true;
+      }
+
+    protected:
+      bool BeginFrame(bool forceRedraw)
+      {
+        return forceRedraw;
+      }
+
+      // =======================================================================
+
+      void DrawRun(const FBPixel* row,
+                   int x,
+                   int y,
+                   int count,
+                   FrameStats& stats)
+      {
+        chtype attr = COLOR_PAIR(GetOrSetColor(row[x].ColorKey));
+
+        for (int i = 0; i < count; i++)
+        {
+          //
+          // chtype keeps only 8 bits for the character, anything
+          // bigger would spill into color pair and attribute bits.
+          //
+          chtype ch = row[x + i].Character;
+          if ((ch & A_CHARTEXT) != ch)
+          {
+            ch = '?';
+          }
+
+          _runBuffer[i] = (ch | attr);
+        }
+
+        mvaddchnstr(y, x, _runBuffer.data(), count);
+
+        stats.RunsEmitted++;
+      }
+
+      // =======================================================================
+
+      void EndFrame(FrameStats& stats)
+      {
+        refresh();
+
+        #ifdef PRINTER_STATS
+        stats.NewColorPairs    = _counters.NewColorPairs;
+        stats.NewColors        = _counters.NewColors;
+        stats.ColorCacheHits   = _counters.ColorCacheHits;
+        stats.ColorCacheMisses = _counters.ColorCacheMisses;
+
+        _counters = FrameStats();
+        #else
+        (void)stats;
+        #endif
+      }
+
+      // =======================================================================
+
+      void OnClear()
+      {
+      }
+
+      // =======================================================================
+
+      int _terminalWidth  = 0;
+      int _terminalHeight = 0;
+
+    private:
+      bool ColorIndexExists(const uint32_t& htmlColor)
+      {
+        return (_colorIndexMap.count(htmlColor) == 1);
+      }
+
+      // =======================================================================
+
+      NColor GetNColor(const uint32_t& htmlColor)
+      {
+        NColor ret;
+
+        int valueR = ((htmlColor & kMaskR) >> 16);
+        int valueG = ((htmlColor & kMaskG) >> 8);
+        int valueB = (htmlColor  & kMaskB);
+
+        //
+        // ncurses color component has range from 0 to 1000
+        //
+        int scaledValueR = (valueR / 255.0f) * 1000;
+        int scaledValueG = (valueG / 255.0f) * 1000;
+        int scaledValueB = (valueB / 255.0f) * 1000;
+
+        ret.R = scaledValueR;
+        ret.G = scaledValueG;
+        ret.B = scaledValueB;
+
+        return ret;
+      }
+
+      // =======================================================================
+
+      short GetOrSetColorIndex(const uint32_t& htmlColor)
+      {
+        if (ColorIndexExists(htmlColor))
+        {
+          return _colorIndexMap[htmlColor];
+        }
+
+        NColor nc = GetNColor(htmlColor);
+
+        nc.ColorIndex = _colorGlobalIndex++;
+        _colorIndexMap[htmlColor] = nc.ColorIndex;
+
+        init_color(nc.ColorIndex, nc.R, nc.G, nc.B);
+
+        #ifdef PRINTER_STATS
+        _counters.NewColors++;
+        #endif
+
+        return nc.ColorIndex;
+      }
+
+      // =======================================================================
+
+      short GetOrSetColor(uint64_t key)
+      {
+        //
+        // Consecutive cells usually share colors (background, strings),
+        // so don't even go to the table in this case.
+        //
+        if (key == _lastColorKey)
+        {
+          #ifdef PRINTER_STATS
+          _counters.ColorCacheHits++;
+          #endif
+
+          return _lastPairIndex;
+        }
+
+        short pairIndex = _colorPairs.Find(key);
+
+        #ifdef PRINTER_STATS
+        if (pairIndex == -1)
+        {
+          _counters.ColorCacheMisses++;
+        }
+        else
+        {
+          _counters.ColorCacheHits++;
+        }
+        #endif
+
+        if (pairIndex == -1)
+        {
+          PRINTER_TRACE_SCOPE("init_pair");
+
+          uint32_t htmlColorFg = (key >> 24);
+          uint32_t htmlColorBg = (key & 0xFFFFFF);
+
+          short fgIndex = GetOrSetColorIndex(htmlColorFg);
+          short bgIndex = GetOrSetColorIndex(htmlColorBg);
+
+          pairIndex = _colorPairsGlobalIndex++;
+
+          init_pair(pairIndex, fgIndex, bgIndex);
+
+          #ifdef PRINTER_STATS
+          _counters.NewColorPairs++;
+          #endif
+
+          _colorPairs.Insert(key, pairIndex);
+        }
+
+        _lastColorKey  = key;
+        _lastPairIndex = pairIndex;
+
+        return pairIndex;
+      }
+
+      // =======================================================================
+
+      ColorPairTable _colorPairs;
+      std::unordered_map<uint32_t, short> _colorIndexMap;
+
+      uint64_t _lastColorKey = 0xFFFFFFFFFFFFFFFF;
+      short _lastPairIndex   = 0;
+
+      short _colorPairsGlobalIndex = 1;
+      short _colorGlobalIndex = 8;
+
+      //
+      // Characters with attributes of one span for mvaddchnstr()
+      //
+      std::vector<chtype> _runBuffer;
+
+      #ifdef PRINTER_STATS
+      //
+      // Color counters of the frame being rendered.
+      //
+      FrameStats _counters;
+      #endif
+  };
+#endif
+
+  // ===========================================================================
+
+  ///
+  /// Turns cells into 24-bit color VT/ANSI escape sequences,
+  /// skipping cursor moves and color changes terminal doesn't need.
+  /// Used by VTBackend and CastWriter.
+  ///
+  class VTEncoder
+  {
+    public:
+      void Init(int width, int height)
+      {
+        _width = width;
+
+        //
+        // Roughly enough for full screen redraw
+        // with color change on every cell.
+        //
+        _buffer.reserve(width * height * 16);
+      }
+
+      // =======================================================================
+
+      /// Forgets cursor position and colors,
+      /// so next run sets them from scratch.
+      void Reset()
+      {
+        _cursorX = -1;
+        _cursorY = -1;
+        _sgrKey  = kUnknownColorKey;
+      }
+
+      // =======================================================================
+
+      void EncodeRun(const FBPixel* row,
+                     int x,
+                     int y,
+                     int count,
+                     FrameStats& stats)
+      {
+        for (int i = x; i < x + count; i++)
+        {
+          MoveCursor(i, y, row, stats);
+          SetColor(row[i].ColorKey);
+          AppendGlyph(row[i].Character);
+
+          _cursorX++;
+
+          //
+          // Terminals differ in what they do after
+          // writing into the last column, so don't rely on it.
+          //
+          if (_cursorX == _width)
+          {
+            _cursorX = -1;
+            _cursorY = -1;
+          }
+        }
+      }
+
+      // =======================================================================
+
+      std::string& Buffer() { return _buffer; }
+
+      // =======================================================================
+
+    private:
+      void AppendNumber(int number)
+      {
+        char digits[12];
+        int len = 0;
+
+        do
+        {
+          digits[len++] = '0' + (number % 10);
+          number /= 10;
+        }
+        while (number != 0);
+
+        while (len != 0)
+        {
+          _buffer += digits[--len];
+        }
+      }
+
+      // =======================================================================
+
+      void AppendRGB(uint32_t htmlColor)
+      {
+        AppendNumber((htmlColor & kMaskR) >> 16);
+        _buffer += ';';
+        AppendNumber((htmlColor & kMaskG) >> 8);
+        _buffer += ';';
+        AppendNumber(htmlColor & kMaskB);
+      }
+
+      // =======================================================================
+
+      ///
+      /// Glyphs below 256 are treated as CP437,
+      /// everything else as Unicode code point up to kMaxCharacter,
+      /// so three bytes are enough and surrogates never get here.
+      ///
+      void AppendGlyph(uint32_t ch)
+      {
+        uint32_t cp = (ch < 256) ? kCP437ToUnicode[ch] : ch;
+
+        if (cp < 0x80)
+        {
+          _buffer += (char)cp;
+        }
+        else if (cp < 0x800)
+        {
+          _buffer += (char)(0xC0 | (cp >> 6));
+          _buffer += (char)(0x80 | (cp & 0x3F));
+        }
+        else
+        {
+          _buffer += (char)(0xE0 | (cp >> 12));
+          _buffer += (char)(0x80 | ((cp >> 6) & 0x3F));
+          _buffer += (char)(0x80 | (cp & 0x3F));
+        }
+      }
+
+      // =======================================================================
+
+      ///
+      /// Emits only those SGR parameters that differ from current ones.
+      ///
+      void SetColor(uint64_t key)
+      {
+        if (key == _sgrKey)
+        {
+          return;
+        }
+
+        bool unknown   = (_sgrKey == kUnknownColorKey);
+        bool fgChanged = unknown || (GetKeyFg(key) != GetKeyFg(_sgrKey));
+        bool bgChanged = unknown || (GetKeyBg(key) != GetKeyBg(_sgrKey));
+
+        _buffer += "\x1b[";
+
+        if (fgChanged)
+        {
+          _buffer += "38;2;";
+          AppendRGB(GetKeyFg(key));
+        }
+
+        if (bgChanged)
+        {
+          if (fgChanged)
+          {
+            _buffer += ';';
+          }
+
+          _buffer += "48;2;";
+          AppendRGB(GetKeyBg(key));
+        }
+
+        _buffer += 'm';
+
+        _sgrKey = key;
+      }
+
+      // =======================================================================
+
+      ///
+      /// Cheapest way to get cursor to (x, y) given what's in the row.
+      ///
+      void MoveCursor(int x,
+                      int y,
+                      const FBPixel* row,
+                      FrameStats& stats)
+      {
+        if (_cursorX == x && _cursorY == y)
+        {
+          return;
+        }
+
+        stats.RunsEmitted++;
+
+        if (_cursorY == y && _cursorX != -1 && x > _cursorX)
+        {
+          int gap = x - _cursorX;
+
+          //
+          // "ESC [ n C" is at least 4 bytes, so it's shorter
+          // to just print few skipped cells again if they're
+          // plain ASCII of current color.
+          //
+          bool canReprint = (gap <= 3);
+          for (int i = _cursorX; i < x && canReprint; i++)
+          {
+            canReprint = (row[i].ColorKey == _sgrKey
+                       && row[i].Character > 32
+                       && row[i].Character < 127);
+          }
+
+          if (canReprint)
+          {
+            for (int i = _cursorX; i < x; i++)
+            {
+              _buffer += (char)row[i].Character;
+            }
+          }
+          else
+          {
+            _buffer += "\x1b[";
+            AppendNumber(gap);
+            _buffer += 'C';
+          }
+        }
+        else
+        {
+          _buffer += "\x1b[";
+          AppendNumber(y + 1);
+          _buffer += ';';
+          AppendNumber(x + 1);
+          _buffer += 'H';
+        }
+
+        _cursorX = x;
+        _cursorY = y;
+      }
+
+      // =======================================================================
+
+      static const uint64_t kUnknownColorKey = 0xFFFFFFFFFFFFFFFF;
+
+      int _width = 0;
+
+      //
+      // Terminal state after last run:
+      // cursor position (-1 if unknown) and current SGR colors.
+      //
+      int _cursorX = -1;
+      int _cursorY = -1;
+
+      uint64_t _sgrKey = kUnknownColorKey;
+
+      std::string _buffer;
+  };
+
+#ifdef PRINTER_HAS_VT
+  // ===========================================================================
+
+  ///
+  /// Writes 24-bit color VT/ANSI escape sequences
+  /// to a file descriptor, no ncurses needed.
+  ///
+  class VTBackend
+  {
+    public:
+      static const bool kTransparentBlank = false;
+      static const bool kBlackAndWhite    = false;
+      static const bool kCP437Frames      = false;
+      static const bool kPixelHeader      = false;
+
+      /// @param[in] fd File descriptor to write frames to.
+      /// @param[in] width Terminal width in characters, queried from fd if 0.
+      /// @param[in] height Terminal height in characters, queried from fd if 0.
+      bool Init(int fd = STDOUT_FILENO, int width = 0, int height = 0)
+      {
+        _fd = fd;
+
+        if (width <= 0 || height <= 0)
+        {
+          winsize ws;
+
+          if (ioctl(_fd, TIOCGWINSZ, &ws) == -1 || ws.ws_col == 0)
+          {
+            printf("%s - couldn't get terminal size, specify it explicitly!\n",
+                   __PRETTY_FUNCTION__);
+            return false;
+          }
+
+          width  = ws.ws_col;
+          height = ws.ws_row;
+        }
+
+        _terminalWidth  = width;
+        _terminalHeight = height;
+
+        _encoder.Init(width, height);
+
+        return true;
+      }
+
+    protected:
+      bool BeginFrame(bool forceRedraw)
+      {
+        _encoder.Buffer().clear();
+
+        if (forceRedraw)
+        {
+          _encoder.Reset();
+        }
+
+        return forceRedraw;
+      }
+
+      // =======================================================================
+
+      void DrawRun(const FBPixel* row,
+                   int x,
+                   int y,
+                   int count,
+                   FrameStats& stats)
+      {
+        _encoder.EncodeRun(row, x, y, count, stats);
+      }
+
+      // =======================================================================
+
+      void EndFrame(FrameStats& stats)
+      {
+        VTFlush(stats);
+      }
+
+      // =======================================================================
+
+      void OnClear()
+      {
+      }
+
+      // =======================================================================
+
+      int _terminalWidth  = 0;
+      int _terminalHeight = 0;
+
+    private:
+      void VTFlush(FrameStats& stats)
+      {
+        const std::string& buf = _encoder.Buffer();
+
+        size_t written = 0;
+
+        while (written < buf.size())
+        {
+          ssize_t res = write(_fd,
+                              buf.data() + written,
+                              buf.size() - written);
+          if (res == -1)
+          {
+            if (errno == EINTR)
+            {
+              continue;
+            }
+
+            //
+            // Non-blocking fd is full, so wait for the terminal
+            // to drain instead of spinning on write().
+            //
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+              pollfd pfd = { _fd, POLLOUT, 0 };
+
+              if (poll(&pfd, 1, -1) != -1 || errno == EINTR)
+              {
+                continue;
+              }
+
+              printf("%s - poll() failed: %s\n",
+                     __PRETTY_FUNCTION__,
+                     strerror(errno));
+              break;
+            }
+
+            printf("%s - write() failed: %s\n",
+                   __PRETTY_FUNCTION__,
+                   strerror(errno));
+            break;
+          }
+
+          written += res;
+        }
+
+        stats.BytesWritten = written;
+      }
+
+      // =======================================================================
+
+      int _fd = -1;
+
+      //
+      // Whole frame goes here and then out with one write().
+      //
+      VTEncoder _encoder;
+  };
+#endif
+
+  // ===========================================================================
+
+  ///
+  /// Streams frames into asciinema v2 .cast file.
+  /// Printer only copies cells into the queue, diffing against
+  /// previous frame, VT encoding and disk writes are done
+  /// by writer thread, so Render() never waits for disk.
+  ///
+  class CastWriter
+  {
+    public:
+      ~CastWriter()
+      {
+        Close();
+      }
+
+      // =======================================================================
+
+      /// Frames of other size are cut or padded to width x height.
+      bool Open(const std::string& fname, int width, int height)
+      {
+        Close();
+
+        _file = fopen(fname.data(), "w");
+        if (_file == nullptr)
+        {
+          printf("%s - can't open %s: %s\n",
+                 __PRETTY_FUNCTION__,
+                 fname.data(),
+                 strerror(errno));
+          return false;
+        }
+
+        int res = fprintf(_file,
+                          "{\"version\": 2, \"width\": %d, \"height\": %d, "
+                          "\"timestamp\": %lld, "
+                          "\"env\": {\"TERM\": \"xterm-256color\"}}\n",
+                          width,
+                          height,
+                          (long long)time(nullptr));
+        if (res < 0)
+        {
+          printf("%s - can't write %s: %s\n",
+                 __PRETTY_FUNCTION__,
+                 fname.data(),
+                 strerror(errno));
+          fclose(_file);
+          _file = nullptr;
+          return false;
+        }
+
+        _width  = width;
+        _height = height;
+        _stop   = false;
+        _failed = false;
+        _start  = std::chrono::steady_clock::now();
+
+        _prev.clear();
+        _encoder.Init(width, height);
+
+        _thread = std::thread(&CastWriter::WriterLoop, this);
+
+        return true;
+      }
+
+      // =======================================================================
+
+      /// Waits until all queued frames are written.
+      /// Cast ends with colors reset and cursor shown again.
+      void Close()
+      {
+        if (_file == nullptr)
+        {
+          return;
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(_mutex);
+
+          _stop     = true;
+          _stopTime = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - _start).count();
+        }
+
+        _cv.notify_one();
+        _thread.join();
+
+        if (fclose(_file) != 0 && not _failed)
+        {
+          printf("%s - write failed, cast is truncated: %s\n",
+                 __PRETTY_FUNCTION__,
+                 strerror(errno));
+        }
+
+        _file = nullptr;
+      }
+
+      // =======================================================================
+
+      /// False after a failed write too, cast has stopped then.
+      bool IsOpen() const { return (_file != nullptr && not _failed); }
+
+      // =======================================================================
+
+      /// Printer calls it at the end of every Render().
+      void AddFrame(const std::vector<FBPixel>& frame, int width, int height)
+      {
+        if (not IsOpen())
+        {
+          return;
+        }
+
+        double time = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - _start).count();
+
+        std::unique_lock<std::mutex> lock(_mutex);
+
+        //
+        // If writer falls behind, newest frame replaces
+        // the last queued one instead of piling up.
+        //
+        if (_queue.size() >= kMaxQueuedFrames)
+        {
+          _free.push_back(std::move(_queue.back().Cells));
+          _queue.pop_back();
+        }
+
+        QueuedFrame queued;
+
+        queued.Time = time;
+
+        if (not _free.empty())
+        {
+          queued.Cells = std::move(_free.back());
+          _free.pop_back();
+        }
+
+        queued.Cells.assign((size_t)_width * _height, FBPixel());
+
+        int w = std::min(width, _width);
+        int h = std::min(height, _height);
+
+        for (int y = 0; y < h; y++)
+        {
+          auto row = frame.begin() + y * width;
+          std::copy(row, row + w, queued.Cells.begin() + y * _width);
+        }
+
+        _queue.push_back(std::move(queued));
+
+        lock.unlock();
+
+        _cv.notify_one();
+      }
+
+      // =======================================================================
+
+    private:
+      struct QueuedFrame
+      {
+        double Time = 0.0;
+        std::vector<FBPixel> Cells;
+      };
+
+      // =======================================================================
+
+      void WriterLoop()
+      {
+        QueuedFrame frame;
+
+        while (true)
+        {
+          {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            _cv.wait(lock, [this] { return (_stop || not _queue.empty()); });
+
+            if (_queue.empty())
+            {
+              break;
+            }
+
+            if (frame.Cells.capacity() != 0)
+            {
+              _free.push_back(std::move(frame.Cells));
+            }
+
+            frame = std::move(_queue.front());
+            _queue.pop_front();
+          }
+
+          if (not WriteFrame(frame))
+          {
+            return;
+          }
+        }
+
+        WriteEvent(_stopTime, "\x1b[0m\x1b[?25h");
+      }
+
+      // =======================================================================
+
+      //
+      // Only cells that differ from previous frame are sent,
+      // first frame is sent whole.
+      //
+      bool WriteFrame(QueuedFrame& frame)
+      {
+        std::string& vt = _encoder.Buffer();
+
+        vt.clear();
+
+        bool first = _prev.empty();
+
+        if (first)
+        {
+          _encoder.Reset();
+
+          //
+          // Hide cursor.
+          //
+          vt += "\x1b[?25l";
+        }
+
+        FrameStats stats;
+
+        for (int y = 0; y < _height; y++)
+        {
+          const FBPixel* row  = frame.Cells.data() + y * _width;
+          const FBPixel* prev = first ? nullptr : _prev.data() + y * _width;
+
+          if (prev != nullptr
+           && memcmp(row, prev, _width * sizeof(FBPixel)) == 0)
+          {
+            continue;
+          }
+
+          int x = 0;
+
+          while (x < _width)
+          {
+            if (prev != nullptr && row[x] == prev[x])
+            {
+              x++;
+              continue;
+            }
+
+            int runStart = x;
+
+            while (x < _width && (prev == nullptr || not (row[x] == prev[x])))
+            {
+              x++;
+            }
+
+            _encoder.EncodeRun(row, runStart, y, x - runStart, stats);
+          }
+        }
+
+        std::swap(_prev, frame.Cells);
+
+        if (vt.empty())
+        {
+          return true;
+        }
+
+        return WriteEvent(frame.Time, vt);
+      }
+
+      // =======================================================================
+
+      //
+      // Failed write stops the writer, frames added after it are dropped.
+      //
+      bool WriteEvent(double time, const std::string& vt)
+      {
+        _json.clear();
+
+        char prefix[64];
+        snprintf(prefix, sizeof(prefix), "[%.6f, \"o\", \"", time);
+
+        _json += prefix;
+
+        for (char c : vt)
+        {
+          AppendJSONChar(c);
+        }
+
+        _json += "\"]\n";
+
+        if (fwrite(_json.data(), 1, _json.size(), _file) != _json.size())
+        {
+          printf("%s - write failed, cast stopped: %s\n",
+                 __PRETTY_FUNCTION__,
+                 strerror(errno));
+          _failed = true;
+          return false;
+        }
+
+        return true;
+      }
+
+      // =======================================================================
+
+      //
+      // VT output is valid UTF-8, so only quotes, backslashes
+      // and control characters need escaping.
+      //
+      void AppendJSONChar(char c)
+      {
+        if (c == '"' || c == '\\')
+        {
+          _json += '\\';
+          _json += c;
+        }
+        else if ((unsigned char)c < 0x20)
+        {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)c);
+          _json += escaped;
+        }
+        else
+        {
+          _json += c;
+        }
+      }
+
+      // =======================================================================
+
+      static const size_t kMaxQueuedFrames = 64;
+
+      FILE* _file = nullptr;
+
+      int _width  = 0;
+      int _height = 0;
+
+      std::chrono::steady_clock::time_point _start;
+
+      std::thread _thread;
+      std::mutex _mutex;
+      std::condition_variable _cv;
+
+      bool _stop = false;
+
+      double _stopTime = 0.0;
+
+      //
+      // Set by writer thread when a write fails.
+      //
+      std::atomic<bool> _failed { false };
+
+      std::deque<QueuedFrame> _queue;
+
+      //
+      // Cell buffers of written frames, reused for new ones.
+      //
+      std::vector<std::vector<FBPixel>> _free;
+
+      //
+      // Writer thread only.
+      //
+      std::vector<FBPixel> _prev;
+
+      VTEncoder _encoder;
+
+      std::string _json;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Draws cells into ARGB8888 pixel buffer with 1 bit per pixel glyphs.
+  /// Used by headless backend and by SDL in RenderMode::Software.
+  ///
+  class SoftwareRasterizer
+  {
+    protected:
+      void RasterizeCell(int x, int y, const FBPixel& cell)
+      {
+        //
+        // ARGB8888 is html color with alpha on top.
+        //
+        uint32_t fg = 0xFF000000 | GetKeyFg(cell.ColorKey);
+        uint32_t bg = cell.Transparent
+                    ? 0
+                    : (0xFF000000 | GetKeyBg(cell.ColorKey));
+
+        uint32_t* dst = &_pixels[(y * _tileHeight) * _pixelsWidth
+                               + (x * _tileWidth)];
+
+        size_t tile = cell.Character;
+        size_t tileMaskSize = _tileHeight * _glyphMaskStride;
+
+        if (cell.Character == ' ' || tile >= _glyphCount)
+        {
+          for (int row = 0; row < _tileHeight; row++)
+          {
+            std::fill(dst, dst + _tileWidth, bg);
+            dst += _pixelsWidth;
+          }
+        }
+        else
+        {
+          const uint8_t* mask = _glyphMasks + tile * tileMaskSize;
+
+          for (int row = 0; row < _tileHeight; row++)
+          {
+            for (int col = 0; col < _tileWidth; col++)
+            {
+              bool set = (mask[col / 8] & (0x80 >> (col % 8)));
+              dst[col] = set ? fg : bg;
+            }
+
+            mask += _glyphMaskStride;
+            dst  += _pixelsWidth;
+          }
+        }
+
+        _dirtyX1 = std::min(_dirtyX1, x);
+        _dirtyY1 = std::min(_dirtyY1, y);
+        _dirtyX2 = std::max(_dirtyX2, x + 1);
+        _dirtyY2 = std::max(_dirtyY2, y + 1);
+      }
+
+      // =======================================================================
+
+      void UseEmbeddedGlyphs()
+      {
+        _glyphMasks      = kTileset8x16;
+        _glyphCount      = 256;
+        _glyphMaskStride = 1;
+      }
+
+      // =======================================================================
+
+      int _tileWidth  = 0;
+      int _tileHeight = 0;
+
+      //
+      // Tiles as 1 bit per pixel masks, _glyphMaskStride bytes per row.
+      // Points either to kTileset8x16 or to SDLBackend's FontResource.
+      //
+      const uint8_t* _glyphMasks = nullptr;
+      size_t _glyphCount   = 0;
+      int _glyphMaskStride = 0;
+
+      //
+      // Software rasterizer target, ARGB8888.
+      //
+      std::vector<uint32_t> _pixels;
+
+      int _pixelsWidth  = 0;
+      int _pixelsHeight = 0;
+
+      //
+      // Cells area changed since last UploadPixels().
+      //
+      int _dirtyX1 = 0;
+      int _dirtyY1 = 0;
+      int _dirtyX2 = 0;
+      int _dirtyY2 = 0;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Renders frames into memory: cells and optionally pixels
+  /// drawn with the embedded 8x16 font. No terminal or display needed.
+  ///
+  class HeadlessBackend : public SoftwareRasterizer
+  {
+    public:
+      static const bool kTransparentBlank = false;
+      static const bool kBlackAndWhite    = false;
+      static const bool kCP437Frames      = false;
+      static const bool kPixelHeader      = false;
+
+      /// @param[in] width Frame width in characters.
+      /// @param[in] height Frame height in characters.
+      /// @param[in] withPixels Also rasterize frames with embedded
+      ///                       8x16 font, see Pixels().
+      bool Init(int width, int height, bool withPixels = false)
+      {
+        if (width <= 0 || height <= 0)
+        {
+          printf("%s - invalid frame size %dx%d\n",
+                 __PRETTY_FUNCTION__,
+                 width,
+                 height);
+          return false;
+        }
+
+        _terminalWidth  = width;
+        _terminalHeight = height;
+
+        if (withPixels)
+        {
+          _tileWidth  = 8;
+          _tileHeight = 16;
+
+          UseEmbeddedGlyphs();
+
+          _pixelsWidth  = _terminalWidth  * _tileWidth;
+          _pixelsHeight = _terminalHeight * _tileHeight;
+
+          _pixels.assign(_pixelsWidth * _pixelsHeight, 0);
+        }
+
+        return true;
+      }
+
+      // =======================================================================
+
+      /// ARGB8888 frame as of last Render(), row by row.
+      /// Empty if Init() was called with withPixels = false.
+      const std::vector<uint32_t>& Pixels() { return _pixels; }
+
+      int PixelsWidth()  { return _pixelsWidth;  }
+      int PixelsHeight() { return _pixelsHeight; }
+
+      // =======================================================================
+
+      /// Writes Pixels() as binary PPM (P6).
+      bool DumpPPM(const std::string& fname)
+      {
+        FILE* f = OpenDumpFile(fname);
+        if (f == nullptr)
+        {
+          return false;
+        }
+
+        fprintf(f, "P6\n%d %d\n255\n", _pixelsWidth, _pixelsHeight);
+
+        std::vector<uint8_t> line(_pixelsWidth * 3);
+
+        for (int y = 0; y < _pixelsHeight; y++)
+        {
+          const uint32_t* px = &_pixels[y * _pixelsWidth];
+
+          for (int x = 0; x < _pixelsWidth; x++)
+          {
+            line[x * 3 + 0] = (px[x] & kMaskR) >> 16;
+            line[x * 3 + 1] = (px[x] & kMaskG) >> 8;
+            line[x * 3 + 2] = (px[x] & kMaskB);
+          }
+
+          fwrite(line.data(), 1, line.size(), f);
+        }
+
+        return (fclose(f) == 0);
+      }
+
+      // =======================================================================
+
+      /// Writes Pixels() as 24 bit BMP.
+      bool DumpBMP(const std::string& fname)
+      {
+        FILE* f = OpenDumpFile(fname);
+        if (f == nullptr)
+        {
+          return false;
+        }
+
+        //
+        // Rows are padded to 4 bytes.
+        //
+        uint32_t stride    = (_pixelsWidth * 3 + 3) & ~3;
+        uint32_t dataSize  = stride * _pixelsHeight;
+        uint32_t headerSize = 14 + 40;
+
+        std::vector<uint8_t> header(headerSize, 0);
+
+        auto put32 = [&header](size_t offset, uint32_t value)
+        {
+          for (int i = 0; i < 4; i++)
+          {
+            header[offset + i] = (value >> (i * 8)) & 0xFF;
+          }
+        };
+
+        header[0] = 'B';
+        header[1] = 'M';
+        put32(2,  headerSize + dataSize);
+        put32(10, headerSize);
+        put32(14, 40);
+        put32(18, _pixelsWidth);
+        put32(22, _pixelsHeight);
+        put32(26, 1 | (24 << 16));
+        put32(34, dataSize);
+
+        fwrite(header.data(), 1, header.size(), f);
+
+        std::vector<uint8_t> line(stride, 0);
+
+        //
+        // Bottom-up, BGR.
+        //
+        for (int y = _pixelsHeight - 1; y >= 0; y--)
+        {
+          const uint32_t* px = &_pixels[y * _pixelsWidth];
+
+          for (int x = 0; x < _pixelsWidth; x++)
+          {
+            line[x * 3 + 0] = (px[x] & kMaskB);
+            line[x * 3 + 1] = (px[x] & kMaskG) >> 8;
+            line[x * 3 + 2] = (px[x] & kMaskR) >> 16;
+          }
+
+          fwrite(line.data(), 1, line.size(), f);
+        }
+
+        return (fclose(f) == 0);
+      }
+
+    protected:
+      bool BeginFrame(bool forceRedraw)
+      {
+        return forceRedraw;
+      }
+
+      // =======================================================================
+
+      void DrawRun(const FBPixel* row,
+                   int x,
+                   int y,
+                   int count,
+                   FrameStats&)
+      {
+        if (_pixels.empty())
+        {
+          return;
+        }
+
+        for (int i = x; i < x + count; i++)
+        {
+          RasterizeCell(i, y, row[i]);
+        }
+      }
+
+      // =======================================================================
+
+      void EndFrame(FrameStats&)
+      {
+      }
+
+      // =======================================================================
+
+      void OnClear()
+      {
+      }
+
+      // =======================================================================
+
+      int _terminalWidth  = 0;
+      int _terminalHeight = 0;
+
+    private:
+      FILE* OpenDumpFile(const std::string& fname)
+      {
+        if (_pixels.empty())
+        {
+          printf("%s - no pixels, Init() with withPixels = true first\n",
+                 __PRETTY_FUNCTION__);
+          return nullptr;
+        }
+
+        FILE* f = fopen(fname.data(), "wb");
+        if (f == nullptr)
+        {
+          printf("%s - couldn't open %s: %s\n",
+                 __PRETTY_FUNCTION__,
+                 fname.data(),
+                 strerror(errno));
+        }
+
+        return f;
+      }
+  };
+
+#ifdef USE_SDL
+  // ===========================================================================
+
+  struct TileColor
+  {
+    int R = 0;
+    int G = 0;
+    int B = 0;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// How glyphs are submitted to SDL_Renderer.
+  ///
+  enum class RenderMode
+  {
+    // SDL_RenderCopy() per glyph from pre-tinted tileset copies,
+    // grouped by color
+    Immediate = 0,
+    // All glyphs collected as colored quads and drawn with
+    // one SDL_RenderGeometry() call (needs SDL 2.0.18+)
+    Batched,
+    // Glyphs rasterized on CPU into a pixel buffer which is
+    // uploaded to a streaming texture once per frame
+    Software
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Image draw deferred until Render(),
+  /// so images always end up on top of the text layer.
+  ///
+  struct ImageCommand
+  {
+    SDL_Texture* Texture = nullptr;
+    SDL_Rect Src;
+    SDL_Rect Dst;
+    int Angle = 0;
+    SDL_RendererFlip Flip = SDL_FLIP_NONE;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Image loaded with Printer::LoadImage().
+  ///
+  struct ImageInfo
+  {
+    SDL_Texture* Texture = nullptr;
+
+    // Area of Texture occupied by the image
+    SDL_Rect Src;
+
+    // Atlas page index or -1 if Texture is image's own
+    int Page = -1;
+
+    int Width    = 0;
+    int Height   = 0;
+    int RefCount = 0;
+
+    std::string Filename;
+    uint32_t ColorKey = 0;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Image draw recorded between
+  /// Printer::BeginSprites() and Printer::SubmitSprites().
+  ///
+  struct SpriteCommand
+  {
+    SDL_Texture* Texture = nullptr;
+    SDL_Rect Src;
+    SDL_Rect Dst;
+
+    // Texture coordinates of Src for SDL_RenderGeometry()
+    float U1 = 0.0f;
+    float V1 = 0.0f;
+    float U2 = 0.0f;
+    float V2 = 0.0f;
+
+    int Angle = 0;
+    SDL_RendererFlip Flip = SDL_FLIP_NONE;
+    uint32_t Tint = 0xFFFFFF;
+    int Z = 0;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Texture shared by several images.
+  /// Filled by shelves: images are put left to right
+  /// and a new shelf is started below when row is full.
+  ///
+  struct AtlasPage
+  {
+    SDL_Texture* Texture = nullptr;
+
+    // Width and height, pages made before SetImageAtlasing()
+    // changed page size keep the old one
+    int Size = 0;
+
+    int ShelfY      = 0;
+    int ShelfHeight = 0;
+    int CursorX     = 0;
+
+    // Number of loaded images on this page
+    int Images = 0;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Tile draw grouped by color in RenderMode::Immediate.
+  ///
+  struct TileCommand
+  {
+    uint32_t Color = 0;
+    int X    = 0;
+    int Y    = 0;
+    int Tile = 0;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Horizontal span of cells with the same background color.
+  ///
+  struct FillCommand
+  {
+    uint32_t Color = 0;
+    SDL_Rect Rect;
+  };
+
+  // ===========================================================================
+
+  struct TintCacheStats
+  {
+    size_t Hits      = 0;
+    size_t Misses    = 0;
+    size_t Evictions = 0;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Tileset data that doesn't depend on SDL_Renderer.
+  /// Immutable once built, so every SDLBackend using the same font
+  /// references one copy, see FontLibrary.
+  ///
+  struct FontResource
+  {
+    int TileWidth  = 0;
+    int TileHeight = 0;
+
+    // Tileset image size in pixels
+    int Width  = 0;
+    int Height = 0;
+
+    // Tiles per tileset row
+    int Columns = 0;
+
+    size_t GlyphCount = 0;
+
+    //
+    // Tiles as 1 bit per pixel masks, MaskStride bytes per row.
+    // Points either to kTileset8x16 or to LoadedMasks.
+    //
+    const uint8_t* Masks = nullptr;
+    int MaskStride       = 0;
+
+    std::vector<uint8_t> LoadedMasks;
+
+    //
+    // ARGB8888 tileset, transparent pixels have zero alpha.
+    //
+    std::vector<uint32_t> Pixels;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Process wide cache of fonts. Font is built on first request
+  /// and freed when the last SDLBackend using it is gone.
+  ///
+  class FontLibrary
+  {
+    public:
+      /// Empty filename gives embedded 8x16 font.
+      /// Transparent color key is magenta (0xFF, 0x00, 0xFF).
+      static std::shared_ptr<const FontResource> Get(const std::string& fname,
+                                                     int tileWidth,
+                                                     int tileHeight)
+      {
+        static std::mutex mutex;
+        static std::map<std::string, std::weak_ptr<const FontResource>> fonts;
+
+        std::string key = fname
+                        + ':' + std::to_string(tileWidth)
+                        + 'x' + std::to_string(tileHeight);
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto found = fonts.find(key);
+        if (found != fonts.end())
+        {
+          std::shared_ptr<const FontResource> font = found->second.lock();
+          if (font)
+          {
+            return font;
+          }
+        }
+
+        std::shared_ptr<const FontResource> font = fname.empty()
+                                                 ? CreateEmbedded()
+                                                 : Load(fname,
+                                                        tileWidth,
+                                                        tileHeight);
+        if (font)
+        {
+          fonts[key] = font;
+        }
+
+        return font;
+      }
+
+    private:
+      ///
+      /// Expands kTileset8x16 into 16x16 tiles image:
+      /// white glyphs on transparent background.
+      ///
+      static std::shared_ptr<FontResource> CreateEmbedded()
+      {
+        auto font = std::make_shared<FontResource>();
+
+        font->TileWidth  = 8;
+        font->TileHeight = 16;
+        font->Columns    = 16;
+        font->Width      = font->Columns * font->TileWidth;
+        font->Height     = (256 / font->Columns) * font->TileHeight;
+        font->GlyphCount = 256;
+        font->Masks      = kTileset8x16;
+        font->MaskStride = 1;
+
+        font->Pixels.assign(font->Width * font->Height, 0);
+
+        for (int tile = 0; tile < 256; tile++)
+        {
+          int tx = (tile % font->Columns) * 8;
+          int ty = (tile / font->Columns) * 16;
+
+          for (int y = 0; y < 16; y++)
+          {
+            uint8_t bits = kTileset8x16[tile * 16 + y];
+
+            uint32_t* px = &font->Pixels[(ty + y) * font->Width + tx];
+
+            for (int x = 0; x < 8; x++)
+            {
+              px[x] = (bits & (0x80 >> x)) ? 0xFFFFFFFF : 0;
+            }
+          }
+        }
+
+        return font;
+      }
+
+      // =======================================================================
+
+      static std::shared_ptr<FontResource> Load(const std::string& fname,
+                                                int tileWidth,
+                                                int tileHeight)
+      {
+        SDL_Surface* surf = SDL_LoadBMP(fname.data());
+        if (surf == nullptr)
+        {
+          printf("***** Could not load tileset %s - %s!\n",
+                 fname.data(), SDL_GetError());
+          return nullptr;
+        }
+
+        SDL_Surface* argb = SDL_ConvertSurfaceFormat(surf,
+                                                     SDL_PIXELFORMAT_ARGB8888,
+                                                     0);
+        SDL_FreeSurface(surf);
+
+        if (argb == nullptr)
+        {
+          printf("%s - couldn't convert tileset: %s\n",
+                 __PRETTY_FUNCTION__,
+                 SDL_GetError());
+          return nullptr;
+        }
+
+        auto font = std::make_shared<FontResource>();
+
+        font->TileWidth  = tileWidth;
+        font->TileHeight = tileHeight;
+        font->Width      = argb->w;
+        font->Height     = argb->h;
+        font->Columns    = argb->w / tileWidth;
+        font->MaskStride = (tileWidth + 7) / 8;
+
+        int tilesY = argb->h / tileHeight;
+
+        font->GlyphCount = font->Columns * tilesY;
+
+        font->Pixels.resize(argb->w * argb->h);
+        font->LoadedMasks.assign(font->GlyphCount
+                               * tileHeight
+                               * font->MaskStride, 0);
+
+        SDL_LockSurface(argb);
+
+        for (int y = 0; y < argb->h; y++)
+        {
+          const uint32_t* px = (const uint32_t*)((const uint8_t*)argb->pixels
+                                               + y * argb->pitch);
+
+          for (int x = 0; x < argb->w; x++)
+          {
+            bool transparent = ((px[x] & 0xFFFFFF) == 0xFF00FF);
+            font->Pixels[y * argb->w + x] = transparent ? 0 : px[x];
+          }
+        }
+
+        SDL_UnlockSurface(argb);
+        SDL_FreeSurface(argb);
+
+        //
+        // Masks go tile by tile in the same order as tile indices.
+        //
+        uint8_t* mask = font->LoadedMasks.data();
+
+        for (int ty = 0; ty < tilesY; ty++)
+        {
+          for (int tx = 0; tx < font->Columns; tx++)
+          {
+            for (int y = 0; y < tileHeight; y++)
+            {
+              const uint32_t* px = &font->Pixels[(ty * tileHeight + y) * font->Width
+                                               + tx * tileWidth];
+
+              for (int x = 0; x < tileWidth; x++)
+              {
+                if ((px[x] >> 24) != 0)
+                {
+                  mask[x / 8] |= (0x80 >> (x % 8));
+                }
+              }
+
+              mask += font->MaskStride;
+            }
+          }
+        }
+
+        font->Masks = font->LoadedMasks.data();
+
+        return font;
+      }
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Copies of the tileset already tinted with particular color,
+  /// so glyphs can be drawn without SDL_SetTextureColorMod()
+  /// between them. Least recently used copy is repainted
+  /// when the cache is full.
+  ///
+  class TintedTilesetCache
+  {
+    public:
+      ~TintedTilesetCache()
+      {
+        for (auto& entry : _entries)
+        {
+          SDL_DestroyTexture(entry.Texture);
+        }
+      }
+
+      // =======================================================================
+
+      void Init(SDL_Renderer* renderer,
+                const std::shared_ptr<const FontResource>& font)
+      {
+        _rendererRef = renderer;
+        _font        = font;
+      }
+
+      // =======================================================================
+
+      void SetCapacity(size_t capacity)
+      {
+        _capacity = std::max(capacity, (size_t)1);
+
+        while (_entries.size() > _capacity)
+        {
+          SDL_DestroyTexture(_entries.back().Texture);
+          _textureByColor.erase(_entries.back().Color);
+          _entries.pop_back();
+        }
+      }
+
+      // =======================================================================
+
+      SDL_Texture* Get(uint32_t htmlColor)
+      {
+        auto found = _textureByColor.find(htmlColor);
+        if (found != _textureByColor.end())
+        {
+          _stats.Hits++;
+
+          //
+          // Move to front as most recently used.
+          //
+          _entries.splice(_entries.begin(), _entries, found->second);
+
+          return found->second->Texture;
+        }
+
+        _stats.Misses++;
+
+        SDL_Texture* tex = nullptr;
+
+        if (_entries.size() < _capacity)
+        {
+          tex = SDL_CreateTexture(_rendererRef,
+                                  SDL_PIXELFORMAT_ARGB8888,
+                                  SDL_TEXTUREACCESS_STATIC,
+                                  _font->Width,
+                                  _font->Height);
+          if (tex == nullptr)
+          {
+            printf("%s - couldn't create texture: %s\n",
+                   __PRETTY_FUNCTION__,
+                   SDL_GetError());
+            return nullptr;
+          }
+
+          SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+
+          _entries.push_front(Entry());
+        }
+        else
+        {
+          //
+          // Reuse texture of the least recently used color.
+          //
+          _stats.Evictions++;
+
+          _entries.splice(_entries.begin(), _entries, std::prev(_entries.end()));
+          _textureByColor.erase(_entries.front().Color);
+
+          tex = _entries.front().Texture;
+        }
+
+        Paint(tex, htmlColor);
+
+        _entries.front().Color   = htmlColor;
+        _entries.front().Texture = tex;
+
+        _textureByColor[htmlColor] = _entries.begin();
+
+        return tex;
+      }
+
+      // =======================================================================
+
+      const TintCacheStats& Stats() { return _stats; }
+
+    private:
+      struct Entry
+      {
+        uint32_t Color       = 0;
+        SDL_Texture* Texture = nullptr;
+      };
+
+      // =======================================================================
+
+      void Paint(SDL_Texture* tex, uint32_t htmlColor)
+      {
+        uint32_t r = (htmlColor >> 16) & 0xFF;
+        uint32_t g = (htmlColor >> 8)  & 0xFF;
+        uint32_t b = (htmlColor & 0xFF);
+
+        const std::vector<uint32_t>& tileset = _font->Pixels;
+
+        _tinted.resize(tileset.size());
+
+        for (size_t i = 0; i < tileset.size(); i++)
+        {
+          uint32_t px = tileset[i];
+
+          //
+          // Same as color mod: component * color / 255.
+          //
+          uint32_t pr = (((px >> 16) & 0xFF) * r) / 255;
+          uint32_t pg = (((px >> 8)  & 0xFF) * g) / 255;
+          uint32_t pb = (((px)       & 0xFF) * b) / 255;
+
+          _tinted[i] = (px & 0xFF000000) | (pr << 16) | (pg << 8) | pb;
+        }
+
+        SDL_UpdateTexture(tex,
+                          nullptr,
+                          _tinted.data(),
+                          _font->Width * sizeof(uint32_t));
+      }
+
+      // =======================================================================
+
+      SDL_Renderer* _rendererRef = nullptr;
+
+      std::shared_ptr<const FontResource> _font;
+
+      //
+      // Scratch buffer for Paint().
+      //
+      std::vector<uint32_t> _tinted;
+
+      size_t _capacity = 32;
+
+      //
+      // Most recently used first.
+      //
+      std::list<Entry> _entries;
+      std::unordered_map<uint32_t, std::list<Entry>::iterator> _textureByColor;
+
+      TintCacheStats _stats;
+  };
+
+  // ===========================================================================
+
+  ///
+  /// Output through SDL_Renderer with bitmap font tileset.
+  ///
+  class SDLBackend : public SoftwareRasterizer
+  {
+    public:
+      //
+      // Let renderer's clear color show through.
+      //
+      static const bool kTransparentBlank = true;
+      static const bool kBlackAndWhite    = false;
+      static const bool kCP437Frames      = true;
+      static const bool kPixelHeader      = true;
+
+      ~SDLBackend()
+      {
+        for (auto& i : _images)
+        {
+          if (i.Texture != nullptr && i.Page == -1)
+          {
+            SDL_DestroyTexture(i.Texture);
+          }
+        }
+
+        for (auto& page : _atlasPages)
+        {
+          SDL_DestroyTexture(page.Texture);
+        }
+
+        if (_softwareTexture != nullptr)
+        {
+          SDL_DestroyTexture(_softwareTexture);
+        }
+
+        if (_frameBufferTexture != nullptr)
+        {
+          SDL_DestroyTexture(_frameBufferTexture);
+        }
+
+        if (_tileset != nullptr)
+        {
+          SDL_DestroyTexture(_tileset);
+        }
+      }
+
+      // =======================================================================
+
+      /// @param[in] renderer Reference to SDL_Renderer.
+      /// @param[in] fontImageFilename Font image filename.
+      /// @param[in] charImageWidth Font tileset char width in pixels.
+      /// @param[in] charImageHeight Font tileset char height in pixels.
+      /// @param[in] windowWidth Window created width for framebuffer dimensions calculation.
+      /// @param[in] windowHeight Window created height for framebuffer dimensions calculation.
+      /// @param[in] globalScale Optional parameter to scale the drawn font.
+      bool Init(SDL_Renderer* renderer,
+                const std::string& fontImageFilename,
+                int charImageWidth,
+                int charImageHeight,
+                int windowWidth,
+                int windowHeight,
+                float globalScale = 1.0f)
+      {
+        if (_initialized)
+        {
+          printf("%s - already initialized!\n", __PRETTY_FUNCTION__);
+          return _initialized;
+        }
+
+        _rendererRef     = renderer;
+        _tilesetFilename = fontImageFilename;
+        _tileWidth       = charImageWidth;
+        _tileHeight      = charImageHeight;
+        _globalScale     = globalScale;
+        _windowWidth     = windowWidth;
+        _windowHeight    = windowHeight;
+
+        if (InitForSDL(false))
+        {
+          _initialized = true;
+        }
+
+        return _initialized;
+      }
+
+      // =======================================================================
+
+      bool Init(SDL_Renderer* renderer,
+                int windowWidth,
+                int windowHeight,
+                float globalScale = 1.0f)
+      {
+        if (_initialized)
+        {
+          printf("%s - already initialized!\n", __PRETTY_FUNCTION__);
+          return _initialized;
+        }
+
+        _rendererRef = renderer;
+        _tileWidth = 8;
+        _tileHeight = 16;
+        _globalScale = globalScale;
+        _windowWidth = windowWidth;
+        _windowHeight = windowHeight;
+
+        if (InitForSDL(true))
+        {
+          _initialized = true;
+        }
+
+        return _initialized;
+      }
+
+      // =======================================================================
+
+      /// Batched mode draws whole frame's glyphs with one
+      /// SDL_RenderGeometry() call. If SDL is older than 2.0.18
+      /// Immediate mode is kept.
+      /// Software mode is for software SDL_Renderer,
+      /// where per glyph SDL_RenderCopy() is the slowest.
+      void SetRenderMode(RenderMode mode)
+      {
+        #if !SDL_VERSION_ATLEAST(2, 0, 18)
+        if (mode == RenderMode::Batched)
+        {
+          printf("%s - SDL_RenderGeometry() is not available, "
+                 "staying in immediate mode\n",
+                 __PRETTY_FUNCTION__);
+          return;
+        }
+        #endif
+
+        if (mode == RenderMode::Software && !PrepareSoftwareRenderer())
+        {
+          return;
+        }
+
+        if (mode != _renderMode)
+        {
+          _renderMode = mode;
+
+          //
+          // Target of the new mode doesn't have current frame yet.
+          //
+          _redrawRequested = true;
+        }
+      }
+
+      // =======================================================================
+
+      /// How many tinted tileset copies RenderMode::Immediate keeps.
+      /// Each one takes tileset width * height * 4 bytes of VRAM.
+      void SetTintCacheSize(size_t colors)
+      {
+        _tintCache.SetCapacity(colors);
+      }
+
+      // =======================================================================
+
+      const TintCacheStats& GetTintCacheStats() { return _tintCache.Stats(); }
+      // =======================================================================
+
+      void DrawImage(const int& x,
+                     const int& y,
+                     SDL_Texture* tex)
+      {
+        PRINTER_TRACE_BATCH("DrawImage");
+
+        int tw, th;
+        SDL_QueryTexture(tex, nullptr, nullptr, &tw, &th);
+
+        SDL_Rect src;
+        src.x = 0;
+        src.y = 0;
+        src.w = tw;
+        src.h = th;
+
+        SDL_Rect dst;
+        dst.x = x;
+        dst.y = y;
+        dst.w = tw;
+        dst.h = th;
+
+        QueueImage(tex, src, dst);
+      }
+
+      // =======================================================================
+
+      /// Printer::SetRecorder() passes recorder here.
+      void SetImageRecorder(FrameRecorder* recorder)
+      {
+        _imageRecorder = recorder;
+      }
+
+      // =======================================================================
+
+      /// Images loaded after this call are packed into shared
+      /// pageSize x pageSize textures, so drawing many of them
+      /// doesn't switch textures for every image.
+      /// Image draws are then moved next to earlier ones
+      /// from the same page if they don't overlap anything
+      /// in between, so the image on top stays the same.
+      /// Images bigger than a page still get their own texture.
+      /// Pages that already exist keep their size.
+      void SetImageAtlasing(bool enable, int pageSize = 1024)
+      {
+        _imageAtlasing = enable;
+        _atlasPageSize = pageSize;
+      }
+
+      // =======================================================================
+
+      /// Loading the same file with the same color key again
+      /// returns the same handle, which then has to be
+      /// unloaded as many times as it was loaded.
+      /// @param[in] colorKey Color to make transparent,
+      ///                     Colors::None for no transparency.
+      int LoadImage(const std::string& fname,
+                    uint32_t colorKey = Colors::None)
+      {
+        auto key = std::make_pair(fname, colorKey);
+
+        auto found = _imageIndexByKey.find(key);
+        if (found != _imageIndexByKey.end())
+        {
+          _images[found->second].RefCount++;
+          return found->second;
+        }
+
+        SDL_Surface* surf = SDL_LoadBMP(fname.data());
+        if (surf == nullptr)
+        {
+          printf("Couldn't load image %s: %s\n", fname.data(), SDL_GetError());
+          return -1;
+        }
+
+        if (colorKey != Colors::None)
+        {
+          uint32_t r = ((colorKey & kMaskR) >> 16);
+          uint32_t g = ((colorKey & kMaskG) >> 8);
+          uint32_t b = (colorKey & kMaskB);
+
+          int ok = SDL_SetColorKey(surf, SDL_TRUE, SDL_MapRGB(surf->format, r, g, b));
+          if (ok == -1)
+          {
+            printf("Couldn't set color key: %s\n", SDL_GetError());
+            SDL_FreeSurface(surf);
+            return -1;
+          }
+        }
+
+        ImageInfo info;
+        info.Width    = surf->w;
+        info.Height   = surf->h;
+        info.RefCount = 1;
+        info.Filename = fname;
+        info.ColorKey = colorKey;
+
+        if (!_imageAtlasing || !PackImage(surf, info))
+        {
+          SDL_Texture* tex = SDL_CreateTextureFromSurface(_rendererRef, surf);
+          if (tex == nullptr)
+          {
+            printf("Couldn't create texture from surface: %s\n", SDL_GetError());
+            SDL_FreeSurface(surf);
+            return -1;
+          }
+
+          info.Texture = tex;
+          info.Src     = { 0, 0, info.Width, info.Height };
+        }
+
+        SDL_FreeSurface(surf);
+
+        int ret = -1;
+
+        //
+        // Reuse slot of some unloaded image if there is one.
+        //
+        if (!_freeImageSlots.empty())
+        {
+          ret = _freeImageSlots.back();
+          _freeImageSlots.pop_back();
+
+          _images[ret] = info;
+        }
+        else
+        {
+          _images.push_back(info);
+          ret = _images.size() - 1;
+        }
+
+        _imageIndexByKey[key] = ret;
+
+        return ret;
+      }
+
+      // =======================================================================
+
+      /// Texture is destroyed when the last LoadImage() of it
+      /// is matched by UnloadImage(), draws of it queued for
+      /// next Render() are dropped. Handle may be reused after that.
+      bool UnloadImage(int imageIndex)
+      {
+        if (!IsImageLoaded(imageIndex))
+        {
+          return false;
+        }
+
+        ImageInfo& info = _images[imageIndex];
+
+        info.RefCount--;
+
+        if (info.RefCount == 0)
+        {
+          DropQueuedDraws(info);
+
+          if (info.Page == -1)
+          {
+            SDL_DestroyTexture(info.Texture);
+          }
+          else
+          {
+            ReleaseAtlasImage(info.Page);
+          }
+
+          _imageIndexByKey.erase(std::make_pair(info.Filename, info.ColorKey));
+
+          info = ImageInfo();
+
+          _freeImageSlots.push_back(imageIndex);
+        }
+
+        return true;
+      }
+
+      // =======================================================================
+
+      /// Returns { -1, -1 } for invalid handle.
+      Position ImageSize(int imageIndex)
+      {
+        if (!IsImageLoaded(imageIndex))
+        {
+          return Position(-1, -1);
+        }
+
+        return Position(_images[imageIndex].Width, _images[imageIndex].Height);
+      }
+
+      // =======================================================================
+
+      void DrawImage(int imageIndex,
+                     const SDL_Rect& r,
+                     int angle = 0,
+                     SDL_RendererFlip flip = SDL_RendererFlip::SDL_FLIP_NONE)
+      {
+        PRINTER_TRACE_BATCH("DrawImage");
+
+        if (!IsImageLoaded(imageIndex))
+        {
+          return;
+        }
+
+        const ImageInfo& info = _images[imageIndex];
+
+        if (_imageRecorder != nullptr)
+        {
+          _imageRecorder->AddImage(info.Filename,
+                                   info.ColorKey,
+                                   r.x,
+                                   r.y,
+                                   r.w,
+                                   r.h,
+                                   angle,
+                                   (int)flip);
+        }
+
+        QueueImage(info.Texture, info.Src, r, angle, flip);
+      }
+
+      // =======================================================================
+
+      /// Starts recording DrawSprite() calls.
+      /// @param[in] expectedSprites Number of sprites to reserve memory for.
+      void BeginSprites(size_t expectedSprites = 0)
+      {
+        _spriteQueue.reserve(_spriteQueue.size() + expectedSprites);
+        _spriteBatchStart = _spriteQueue.size();
+        _spritesRecording = true;
+      }
+
+      // =======================================================================
+
+      /// Sprites are drawn on top of text and DrawImage() images
+      /// during next Render(), lower z first.
+      /// @param[in] tint Html color the image is multiplied by.
+      void DrawSprite(int imageIndex,
+                      const SDL_Rect& r,
+                      int z = 0,
+                      int angle = 0,
+                      SDL_RendererFlip flip = SDL_RendererFlip::SDL_FLIP_NONE,
+                      uint32_t tint = Colors::White)
+      {
+        if (!_spritesRecording || !IsImageLoaded(imageIndex))
+        {
+          return;
+        }
+
+        const ImageInfo& info = _images[imageIndex];
+
+        float tw = (info.Page == -1) ? info.Width  : _atlasPages[info.Page].Size;
+        float th = (info.Page == -1) ? info.Height : _atlasPages[info.Page].Size;
+
+        SpriteCommand cmd;
+
+        cmd.Texture = info.Texture;
+        cmd.Src     = info.Src;
+        cmd.Dst     = r;
+        cmd.U1      = info.Src.x / tw;
+        cmd.V1      = info.Src.y / th;
+        cmd.U2      = (info.Src.x + info.Src.w) / tw;
+        cmd.V2      = (info.Src.y + info.Src.h) / th;
+        cmd.Angle   = angle;
+        cmd.Flip    = flip;
+        cmd.Tint    = tint;
+        cmd.Z       = z;
+
+        _spriteQueue.push_back(cmd);
+
+        if (_imageRecorder != nullptr)
+        {
+          _imageRecorder->AddSprite(info.Filename,
+                                    info.ColorKey,
+                                    r.x,
+                                    r.y,
+                                    r.w,
+                                    r.h,
+                                    angle,
+                                    (int)flip,
+                                    z,
+                                    tint);
+        }
+      }
+
+      // =======================================================================
+
+      /// Sorts sprites recorded since BeginSprites() by z and texture.
+      /// Sprites with the same z keep their order within one texture.
+      void SubmitSprites()
+      {
+        std::stable_sort(_spriteQueue.begin() + _spriteBatchStart,
+                         _spriteQueue.end(),
+                         [](const SpriteCommand& a, const SpriteCommand& b)
+                         {
+                           if (a.Z != b.Z)
+                           {
+                             return (a.Z < b.Z);
+                           }
+
+                           return std::less<SDL_Texture*>()(a.Texture,
+                                                            b.Texture);
+                         });
+
+        _spriteBatchStart = _spriteQueue.size();
+        _spritesRecording = false;
+      }
+
+      // =======================================================================
+
+      void DrawImage(const int& x,
+                     const int& y,
+                     const int& w,
+                     const int& h,
+                     SDL_Texture* tex)
+      {
+        PRINTER_TRACE_BATCH("DrawImage");
+
+        int tw, th;
+        SDL_QueryTexture(tex, nullptr, nullptr, &tw, &th);
+
+        SDL_Rect src;
+        src.x = 0;
+        src.y = 0;
+        src.w = tw;
+        src.h = th;
+
+        SDL_Rect dst;
+        dst.x = x;
+        dst.y = y;
+        dst.w = w;
+        dst.h = h;
+
+        QueueImage(tex, src, dst);
+      }
+
+    protected:
+      bool BeginFrame(bool forceRedraw)
+      {
+        //
+        // Only cells changed since last frame are redrawn
+        // on top of what's already in the framebuffer texture
+        // (or pixel buffer in software mode).
+        // Transparent cells are cleared to alpha 0.
+        //
+        if (_renderMode != RenderMode::Software)
+        {
+          SDL_GetRenderDrawColor(_rendererRef,
+                                 &_savedColor.r,
+                                 &_savedColor.g,
+                                 &_savedColor.b,
+                                 &_savedColor.a);
+          SDL_GetRenderDrawBlendMode(_rendererRef, &_savedBlendMode);
+
+          SDL_SetRenderTarget(_rendererRef, _frameBufferTexture);
+          SDL_SetRenderDrawBlendMode(_rendererRef, SDL_BLENDMODE_NONE);
+        }
+
+        bool redrawAll = (forceRedraw || _redrawRequested);
+
+        _redrawRequested = false;
+
+        return redrawAll;
+      }
+
+      // =======================================================================
+
+      void DrawRun(const FBPixel* row,
+                   int x,
+                   int y,
+                   int count,
+                   FrameStats&)
+      {
+        bool software = (_renderMode == RenderMode::Software);
+
+        for (int i = x; i < x + count; i++)
+        {
+          if (software)
+          {
+            RasterizeCell(i, y, row[i]);
+          }
+          else
+          {
+            QueueCell(i, y, row[i]);
+          }
+        }
+      }
+
+      // =======================================================================
+
+      void EndFrame(FrameStats& stats)
+      {
+        bool software = (_renderMode == RenderMode::Software);
+
+        if (software)
+        {
+          UploadPixels();
+        }
+        else
+        {
+          //
+          // All backgrounds first, then all glyphs on top of them.
+          //
+          DrawFillCommands();
+          DrawTileCommands(_fgCommands);
+
+          FlushBatch();
+
+          SDL_SetRenderTarget(_rendererRef, nullptr);
+          SDL_SetRenderDrawColor(_rendererRef,
+                                 _savedColor.r,
+                                 _savedColor.g,
+                                 _savedColor.b,
+                                 _savedColor.a);
+          SDL_SetRenderDrawBlendMode(_rendererRef, _savedBlendMode);
+        }
+
+        SDL_RenderClear(_rendererRef);
+
+        if (software)
+        {
+          SDL_Rect dst = { 0,
+                           0,
+                           _terminalWidth  * _tileWidthScaled,
+                           _terminalHeight * _tileHeightScaled };
+
+          RenderCopy(_softwareTexture, nullptr, &dst);
+        }
+        else
+        {
+          RenderCopy(_frameBufferTexture, nullptr, nullptr);
+        }
+
+        DrawImages();
+        DrawSprites();
+
+        {
+          PRINTER_TRACE_SCOPE("SDL_RenderPresent");
+          SDL_RenderPresent(_rendererRef);
+        }
+
+        #ifdef PRINTER_STATS
+        const TintCacheStats& tint = _tintCache.Stats();
+
+        stats.RenderCopies     = _counters.RenderCopies;
+        stats.ColorMods        = _counters.ColorMods;
+        stats.DrawCalls        = _counters.DrawCalls;
+        stats.ColorCacheHits   = tint.Hits   - _tintStatsAtFrameStart.Hits;
+        stats.ColorCacheMisses = tint.Misses - _tintStatsAtFrameStart.Misses;
+
+        _counters              = FrameStats();
+        _tintStatsAtFrameStart = tint;
+        #else
+        (void)stats;
+        #endif
+      }
+
+      // =======================================================================
+
+      void OnClear()
+      {
+        _imageQueue.clear();
+        _spriteQueue.clear();
+        _spriteBatchStart = 0;
+      }
+      // =======================================================================
+
+      int _terminalWidth  = 0;
+      int _terminalHeight = 0;
+
+    private:
+      bool _initialized = false;
+
+      std::shared_ptr<const FontResource> _font;
+
+      SDL_Texture* _tileset = nullptr;
+      SDL_Texture* _frameBufferTexture = nullptr;
+      SDL_Renderer* _rendererRef = nullptr;
+
+      std::vector<ImageInfo> _images;
+      std::vector<int> _freeImageSlots;
+
+      std::map<std::pair<std::string, uint32_t>, int> _imageIndexByKey;
+
+      bool _imageAtlasing = false;
+      int _atlasPageSize  = 1024;
+
+      std::vector<AtlasPage> _atlasPages;
+
+      std::string _tilesetFilename;
+
+      float _globalScale = 1.0f;
+
+      int _tileWidthScaled = 0;
+      int _tileHeightScaled = 0;
+
+      int _windowWidth = 0;
+      int _windowHeight = 0;
+
+      bool InitForSDL(bool useEmbeddedTileset)
+      {
+        _font = FontLibrary::Get(useEmbeddedTileset ? std::string()
+                                                    : _tilesetFilename,
+                                 _tileWidth,
+                                 _tileHeight);
+        if (!_font)
+        {
+          return false;
+        }
+
+        _glyphMasks      = _font->Masks;
+        _glyphCount      = _font->GlyphCount;
+        _glyphMaskStride = _font->MaskStride;
+
+        _tintCache.Init(_rendererRef, _font);
+
+        _tileset = SDL_CreateTexture(_rendererRef,
+                                     SDL_PIXELFORMAT_ARGB8888,
+                                     SDL_TEXTUREACCESS_STATIC,
+                                     _font->Width,
+                                     _font->Height);
+        if (_tileset == nullptr)
+        {
+          printf("%s - couldn't create tileset texture: %s\n",
+                 __PRETTY_FUNCTION__,
+                 SDL_GetError());
+          return false;
+        }
+
+        SDL_UpdateTexture(_tileset,
+                          nullptr,
+                          _font->Pixels.data(),
+                          _font->Width * sizeof(uint32_t));
+
+        SDL_SetTextureBlendMode(_tileset, SDL_BLENDMODE_BLEND);
+
+        _tileWidthScaled  = _tileWidth * _globalScale;
+        _tileHeightScaled = _tileHeight * _globalScale;
+
+        _terminalWidth  = _windowWidth / _tileWidthScaled;
+        _terminalHeight = _windowHeight / _tileHeightScaled;
+
+        _frameBufferTexture = SDL_CreateTexture(_rendererRef,
+                                                SDL_PIXELFORMAT_RGBA32,
+                                                SDL_TEXTUREACCESS_TARGET,
+                                                _windowWidth,
+                                                _windowHeight);
+
+        //
+        // Text layer persists between frames and is drawn
+        // over renderer's clear color, so start fully transparent.
+        //
+        SDL_SetTextureBlendMode(_frameBufferTexture, SDL_BLENDMODE_BLEND);
+
+        Uint8 r, g, b, a;
+        SDL_GetRenderDrawColor(_rendererRef, &r, &g, &b, &a);
+
+        SDL_SetRenderTarget(_rendererRef, _frameBufferTexture);
+        SDL_SetRenderDrawColor(_rendererRef, 0, 0, 0, 0);
+        SDL_RenderClear(_rendererRef);
+        SDL_SetRenderTarget(_rendererRef, nullptr);
+        SDL_SetRenderDrawColor(_rendererRef, r, g, b, a);
+
+        return true;
+      }
+
+      // =======================================================================
+
+      ///
+      /// Where tile is in the tileset.
+      ///
+      SDL_Rect TileRect(int tileIndex)
+      {
+        SDL_Rect src;
+        src.x = (tileIndex % _font->Columns) * _tileWidth;
+        src.y = (tileIndex / _font->Columns) * _tileHeight;
+        src.w = _tileWidth;
+        src.h = _tileHeight;
+
+        return src;
+      }
+
+      // =======================================================================
+
+      ///
+      /// Pixel buffer and streaming texture for RenderMode::Software.
+      /// Buffer has native tile size, scaling is done on final copy.
+      ///
+      bool PrepareSoftwareRenderer()
+      {
+        if (_softwareTexture != nullptr)
+        {
+          return true;
+        }
+
+        _pixelsWidth  = _terminalWidth  * _tileWidth;
+        _pixelsHeight = _terminalHeight * _tileHeight;
+
+        _softwareTexture = SDL_CreateTexture(_rendererRef,
+                                             SDL_PIXELFORMAT_ARGB8888,
+                                             SDL_TEXTUREACCESS_STREAMING,
+                                             _pixelsWidth,
+                                             _pixelsHeight);
+        if (_softwareTexture == nullptr)
+        {
+          printf("%s - couldn't create streaming texture: %s\n",
+                 __PRETTY_FUNCTION__,
+                 SDL_GetError());
+          return false;
+        }
+
+        SDL_SetTextureBlendMode(_softwareTexture, SDL_BLENDMODE_BLEND);
+
+        _pixels.assign(_pixelsWidth * _pixelsHeight, 0);
+
+        _dirtyX1 = _terminalWidth;
+        _dirtyY1 = _terminalHeight;
+        _dirtyX2 = 0;
+        _dirtyY2 = 0;
+
+        return true;
+      }
+
+      // =======================================================================
+
+      ///
+      /// Sends area of the pixel buffer covering changed cells
+      /// to the streaming texture.
+      ///
+      void UploadPixels()
+      {
+        if (_dirtyX1 >= _dirtyX2 || _dirtyY1 >= _dirtyY2)
+        {
+          return;
+        }
+
+        SDL_Rect r;
+        r.x = _dirtyX1 * _tileWidth;
+        r.y = _dirtyY1 * _tileHeight;
+        r.w = (_dirtyX2 - _dirtyX1) * _tileWidth;
+        r.h = (_dirtyY2 - _dirtyY1) * _tileHeight;
+
+        SDL_UpdateTexture(_softwareTexture,
+                          &r,
+                          &_pixels[r.y * _pixelsWidth + r.x],
+                          _pixelsWidth * sizeof(uint32_t));
+
+        _dirtyX1 = _terminalWidth;
+        _dirtyY1 = _terminalHeight;
+        _dirtyX2 = 0;
+        _dirtyY2 = 0;
+      }
+
+      // =======================================================================
+
+      int RenderCopy(SDL_Texture* tex,
+                     const SDL_Rect* src,
+                     const SDL_Rect* dst)
+      {
+        #ifdef PRINTER_STATS
+        _counters.RenderCopies++;
+        _counters.DrawCalls++;
+        #endif
+
+        return SDL_RenderCopy(_rendererRef, tex, src, dst);
+      }
+
+      // =======================================================================
+
+      int RenderCopyEx(SDL_Texture* tex,
+                       const SDL_Rect* src,
+                       const SDL_Rect* dst,
+                       double angle,
+                       const SDL_Point* center,
+                       SDL_RendererFlip flip)
+      {
+        #ifdef PRINTER_STATS
+        _counters.RenderCopies++;
+        _counters.DrawCalls++;
+        #endif
+
+        return SDL_RenderCopyEx(_rendererRef, tex, src, dst, angle, center, flip);
+      }
+
+      // =======================================================================
+
+      int RenderFillRects(const SDL_Rect* rects, int count)
+      {
+        #ifdef PRINTER_STATS
+        _counters.DrawCalls++;
+        #endif
+
+        return SDL_RenderFillRects(_rendererRef, rects, count);
+      }
+
+      // =======================================================================
+
+      #if SDL_VERSION_ATLEAST(2, 0, 18)
+      int RenderGeometry(SDL_Texture* tex,
+                         const SDL_Vertex* vertices,
+                         int numVertices,
+                         const int* indices,
+                         int numIndices)
+      {
+        #ifdef PRINTER_STATS
+        _counters.DrawCalls++;
+        #endif
+
+        return SDL_RenderGeometry(_rendererRef,
+                                  tex,
+                                  vertices,
+                                  numVertices,
+                                  indices,
+                                  numIndices);
+      }
+
+      // =======================================================================
+      #endif
+
+      int SetColorMod(SDL_Texture* tex, Uint8 r, Uint8 g, Uint8 b)
+      {
+        #ifdef PRINTER_STATS
+        _counters.ColorMods++;
+        #endif
+
+        return SDL_SetTextureColorMod(tex, r, g, b);
+      }
+
+      // =======================================================================
+
+      void DrawTile(int x, int y, int tileIndex)
+      {
+        SDL_Rect src = TileRect(tileIndex);
+
+        SDL_Rect dst;
+        dst.x = x;
+        dst.y = y;
+        dst.w = _tileWidthScaled;
+        dst.h = _tileHeightScaled;
+
+        RenderCopy(_tileset, &src, &dst);
+      }
+
+      // =======================================================================
+
+      void DrawTile(int x, int y, int tileIndex, const uint32_t& htmlColor)
+      {
+        ConvertHtmlToRGB(htmlColor);
+
+        #if SDL_VERSION_ATLEAST(2, 0, 18)
+        if (_renderMode == RenderMode::Batched)
+        {
+          QueueTile(x, y, tileIndex);
+          return;
+        }
+        #endif
+
+        SetColorMod(_tileset,
+                    _convertedHtml.R,
+                    _convertedHtml.G,
+                    _convertedHtml.B);
+        DrawTile(x, y, tileIndex);
+      }
+
+      // =======================================================================
+
+      void FlushBatch()
+      {
+        #if SDL_VERSION_ATLEAST(2, 0, 18)
+        if (_vertices.empty())
+        {
+          return;
+        }
+
+        //
+        // Vertex colors are multiplied by texture color mod.
+        //
+        SetColorMod(_tileset, 255, 255, 255);
+
+        RenderGeometry(_tileset,
+                       _vertices.data(),
+                       _vertices.size(),
+                       _indices.data(),
+                       _indices.size());
+
+        _vertices.clear();
+        _indices.clear();
+        #endif
+      }
+
+      // =======================================================================
+
+      ///
+      /// Queues cell to be drawn onto framebuffer texture:
+      /// background goes to fill spans, glyph goes to tile commands
+      /// (RenderMode::Immediate) or to the vertex batch (RenderMode::Batched).
+      ///
+      void QueueCell(int x, int y, const FBPixel& cell)
+      {
+        int posX = x * _tileWidthScaled;
+        int posY = y * _tileHeightScaled;
+
+        QueueFill(posX,
+                  posY,
+                  cell.Transparent ? Colors::None : GetKeyBg(cell.ColorKey));
+
+        //
+        // Nothing to draw on top of the background.
+        //
+        if (cell.Character == ' ')
+        {
+          return;
+        }
+
+        if (_renderMode == RenderMode::Immediate)
+        {
+          TileCommand cmd;
+
+          cmd.Color = GetKeyFg(cell.ColorKey);
+          cmd.X     = posX;
+          cmd.Y     = posY;
+          cmd.Tile  = cell.Character;
+
+          _fgCommands.push_back(cmd);
+        }
+        else
+        {
+          DrawTile(posX, posY, cell.Character, GetKeyFg(cell.ColorKey));
+        }
+      }
+
+      // =======================================================================
+
+      ///
+      /// Extends previous span if this cell continues it on the same row.
+      /// Colors::None is a transparent span.
+      ///
+      void QueueFill(int posX, int posY, uint32_t htmlColor)
+      {
+        if (!_fillCommands.empty())
+        {
+          FillCommand& last = _fillCommands.back();
+
+          if (last.Color == htmlColor
+           && last.Rect.y == posY
+           && last.Rect.x + last.Rect.w == posX)
+          {
+            last.Rect.w += _tileWidthScaled;
+            return;
+          }
+        }
+
+        FillCommand cmd;
+
+        cmd.Color = htmlColor;
+        cmd.Rect  = { posX, posY, _tileWidthScaled, _tileHeightScaled };
+
+        _fillCommands.push_back(cmd);
+      }
+
+      // =======================================================================
+
+      ///
+      /// One SDL_RenderFillRects() per color.
+      /// Framebuffer texture must be current render target
+      /// with SDL_BLENDMODE_NONE.
+      ///
+      void DrawFillCommands()
+      {
+        std::stable_sort(_fillCommands.begin(),
+                         _fillCommands.end(),
+                         [](const FillCommand& a, const FillCommand& b)
+                         {
+                           return a.Color < b.Color;
+                         });
+
+        size_t i = 0;
+        while (i < _fillCommands.size())
+        {
+          uint32_t color = _fillCommands[i].Color;
+
+          _fillRects.clear();
+
+          while (i < _fillCommands.size() && _fillCommands[i].Color == color)
+          {
+            const SDL_Rect& r = _fillCommands[i].Rect;
+
+            //
+            // Spans come row by row, so same spans of filled
+            // rectangle on consecutive rows make one rect.
+            //
+            if (!_fillRects.empty()
+             && _fillRects.back().x == r.x
+             && _fillRects.back().w == r.w
+             && _fillRects.back().y + _fillRects.back().h == r.y)
+            {
+              _fillRects.back().h += r.h;
+            }
+            else
+            {
+              _fillRects.push_back(r);
+            }
+
+            i++;
+          }
+
+          if (color == Colors::None)
+          {
+            SDL_SetRenderDrawColor(_rendererRef, 0, 0, 0, 0);
+          }
+          else
+          {
+            SDL_SetRenderDrawColor(_rendererRef,
+                                   (color & kMaskR) >> 16,
+                                   (color & kMaskG) >> 8,
+                                   (color & kMaskB),
+                                   255);
+          }
+
+          RenderFillRects(_fillRects.data(), _fillRects.size());
+        }
+
+        _fillCommands.clear();
+      }
+
+      // =======================================================================
+
+      ///
+      /// Draws tiles color by color, so consecutive SDL_RenderCopy()
+      /// calls use the same texture and can be batched by SDL.
+      ///
+      void DrawTileCommands(std::vector<TileCommand>& commands)
+      {
+        std::sort(commands.begin(),
+                  commands.end(),
+                  [](const TileCommand& a, const TileCommand& b)
+                  {
+                    return a.Color < b.Color;
+                  });
+
+        SDL_Texture* tex = nullptr;
+
+        SDL_Rect src;
+        src.w = _tileWidth;
+        src.h = _tileHeight;
+
+        SDL_Rect dst;
+        dst.w = _tileWidthScaled;
+        dst.h = _tileHeightScaled;
+
+        for (size_t i = 0; i < commands.size(); i++)
+        {
+          const TileCommand& cmd = commands[i];
+
+          if (i == 0 || cmd.Color != commands[i - 1].Color)
+          {
+            tex = _tintCache.Get(cmd.Color);
+          }
+
+          if (tex == nullptr || cmd.Tile >= (int)_glyphCount)
+          {
+            continue;
+          }
+
+          SDL_Rect tile = TileRect(cmd.Tile);
+
+          src.x = tile.x;
+          src.y = tile.y;
+
+          dst.x = cmd.X;
+          dst.y = cmd.Y;
+
+          RenderCopy(tex, &src, &dst);
+        }
+
+        commands.clear();
+      }
+
+      // =======================================================================
+
+      ///
+      /// Puts image into the first atlas page where it fits,
+      /// creating new page if needed.
+      ///
+      bool PackImage(SDL_Surface* surf, ImageInfo& info)
+      {
+        //
+        // 1 pixel gap between images, so scaled images
+        // don't pick up neighbours' pixels with linear filtering.
+        //
+        const int pad = 1;
+
+        int w = info.Width  + pad;
+        int h = info.Height + pad;
+
+        int pageIndex = -1;
+
+        for (size_t i = 0; i < _atlasPages.size() && pageIndex == -1; i++)
+        {
+          const AtlasPage& page = _atlasPages[i];
+
+          bool newShelf = (page.CursorX + w > page.Size);
+          int shelfY    = newShelf ? page.ShelfY + page.ShelfHeight : page.ShelfY;
+
+          if (w <= page.Size && shelfY + h <= page.Size)
+          {
+            pageIndex = i;
+          }
+        }
+
+        if (pageIndex == -1)
+        {
+          if (w > _atlasPageSize || h > _atlasPageSize)
+          {
+            return false;
+          }
+
+          AtlasPage page;
+
+          page.Size = _atlasPageSize;
+
+          page.Texture = SDL_CreateTexture(_rendererRef,
+                                           SDL_PIXELFORMAT_ARGB8888,
+                                           SDL_TEXTUREACCESS_STATIC,
+                                           _atlasPageSize,
+                                           _atlasPageSize);
+          if (page.Texture == nullptr)
+          {
+            printf("%s - couldn't create atlas page: %s\n",
+                   __PRETTY_FUNCTION__,
+                   SDL_GetError());
+            return false;
+          }
+
+          SDL_SetTextureBlendMode(page.Texture, SDL_BLENDMODE_BLEND);
+
+          ClearAtlasPage(page);
+
+          _atlasPages.push_back(page);
+          pageIndex = _atlasPages.size() - 1;
+        }
+
+        AtlasPage& page = _atlasPages[pageIndex];
+
+        if (page.CursorX + w > page.Size)
+        {
+          page.ShelfY     += page.ShelfHeight;
+          page.ShelfHeight = 0;
+          page.CursorX     = 0;
+        }
+
+        SDL_Rect r = { page.CursorX, page.ShelfY, info.Width, info.Height };
+
+        SDL_Surface* argb = SDL_ConvertSurfaceFormat(surf,
+                                                     SDL_PIXELFORMAT_ARGB8888,
+                                                     0);
+        if (argb == nullptr)
+        {
+          printf("%s - couldn't convert image: %s\n",
+                 __PRETTY_FUNCTION__,
+                 SDL_GetError());
+          return false;
+        }
+
+        SDL_LockSurface(argb);
+
+        //
+        // Texture update doesn't know about color key,
+        // so make it transparent here.
+        //
+        if (info.ColorKey != Colors::None)
+        {
+          for (int y = 0; y < argb->h; y++)
+          {
+            uint32_t* px = (uint32_t*)((uint8_t*)argb->pixels + y * argb->pitch);
+
+            for (int x = 0; x < argb->w; x++)
+            {
+              if ((px[x] & 0xFFFFFF) == (info.ColorKey & 0xFFFFFF))
+              {
+                px[x] = 0;
+              }
+            }
+          }
+        }
+
+        SDL_UpdateTexture(page.Texture, &r, argb->pixels, argb->pitch);
+
+        SDL_UnlockSurface(argb);
+        SDL_FreeSurface(argb);
+
+        page.CursorX     += w;
+        page.ShelfHeight  = std::max(page.ShelfHeight, h);
+        page.Images++;
+
+        info.Texture = page.Texture;
+        info.Src     = r;
+        info.Page    = pageIndex;
+
+        return true;
+      }
+
+      // =======================================================================
+
+      ///
+      /// Shelves can't free single images, so page space
+      /// is reclaimed only when all its images are unloaded.
+      ///
+      void ReleaseAtlasImage(int pageIndex)
+      {
+        AtlasPage& page = _atlasPages[pageIndex];
+
+        page.Images--;
+
+        if (page.Images == 0)
+        {
+          ClearAtlasPage(page);
+        }
+      }
+
+      // =======================================================================
+
+      void ClearAtlasPage(AtlasPage& page)
+      {
+        std::vector<uint32_t> empty(page.Size * page.Size, 0);
+
+        SDL_UpdateTexture(page.Texture,
+                          nullptr,
+                          empty.data(),
+                          page.Size * sizeof(uint32_t));
+
+        page.ShelfY      = 0;
+        page.ShelfHeight = 0;
+        page.CursorX     = 0;
+      }
+
+      // =======================================================================
+
+      bool IsImageLoaded(int imageIndex)
+      {
+        return (imageIndex >= 0
+             && imageIndex < (int)_images.size()
+             && _images[imageIndex].Texture != nullptr);
+      }
+
+      // =======================================================================
+
+      //
+      // Draws are deferred until Render(),
+      // so they must not outlive the image.
+      //
+      void DropQueuedDraws(const ImageInfo& info)
+      {
+        auto isImage = [&info](SDL_Texture* tex, const SDL_Rect& src)
+        {
+          return (tex == info.Texture
+               && src.x == info.Src.x
+               && src.y == info.Src.y
+               && src.w == info.Src.w
+               && src.h == info.Src.h);
+        };
+
+        _imageQueue.erase(std::remove_if(_imageQueue.begin(),
+                                         _imageQueue.end(),
+                                         [&isImage](const ImageCommand& cmd)
+                                         {
+                                           return isImage(cmd.Texture, cmd.Src);
+                                         }),
+                          _imageQueue.end());
+
+        auto isSprite = [&isImage](const SpriteCommand& cmd)
+        {
+          return isImage(cmd.Texture, cmd.Src);
+        };
+
+        //
+        // Sprites before unsubmitted batch are gone from its start too.
+        //
+        auto batchStart = _spriteQueue.begin() + _spriteBatchStart;
+
+        _spriteBatchStart -= std::count_if(_spriteQueue.begin(),
+                                           batchStart,
+                                           isSprite);
+
+        _spriteQueue.erase(std::remove_if(_spriteQueue.begin(),
+                                          _spriteQueue.end(),
+                                          isSprite),
+                           _spriteQueue.end());
+      }
+
+      // =======================================================================
+
+      void QueueImage(SDL_Texture* tex,
+                      const SDL_Rect& src,
+                      const SDL_Rect& dst,
+                      int angle = 0,
+                      SDL_RendererFlip flip = SDL_FLIP_NONE)
+      {
+        ImageCommand cmd;
+
+        cmd.Texture = tex;
+        cmd.Src     = src;
+        cmd.Dst     = dst;
+        cmd.Angle   = angle;
+        cmd.Flip    = flip;
+
+        _imageQueue.push_back(cmd);
+      }
+
+      // =======================================================================
+
+      void DrawImages()
+      {
+        if (_imageAtlasing)
+        {
+          GroupImagesByTexture();
+        }
+
+        for (auto& cmd : _imageQueue)
+        {
+          if (cmd.Angle == 0 && cmd.Flip == SDL_FLIP_NONE)
+          {
+            RenderCopy(cmd.Texture, &cmd.Src, &cmd.Dst);
+          }
+          else
+          {
+            RenderCopyEx(cmd.Texture,
+                         &cmd.Src,
+                         &cmd.Dst,
+                         cmd.Angle,
+                         nullptr,
+                         cmd.Flip);
+          }
+        }
+
+        _imageQueue.clear();
+      }
+
+      // =======================================================================
+
+      ///
+      /// Moves every image right after the last earlier one
+      /// of the same texture, unless it overlaps some image
+      /// it would be moved in front of.
+      ///
+      void GroupImagesByTexture()
+      {
+        _groupedImages.clear();
+
+        for (const ImageCommand& cmd : _imageQueue)
+        {
+          SDL_Rect bounds = ImageBounds(cmd);
+
+          size_t pos = _groupedImages.size();
+
+          for (size_t i = _groupedImages.size(); i > 0; i--)
+          {
+            const ImageCommand& prev = _groupedImages[i - 1];
+
+            if (prev.Texture == cmd.Texture)
+            {
+              pos = i;
+              break;
+            }
+
+            SDL_Rect prevBounds = ImageBounds(prev);
+
+            if (SDL_HasIntersection(&bounds, &prevBounds))
+            {
+              break;
+            }
+          }
+
+          _groupedImages.insert(_groupedImages.begin() + pos, cmd);
+        }
+
+        _imageQueue.swap(_groupedImages);
+      }
+
+      // =======================================================================
+
+      //
+      // Rotated image's diagonal is at most w + h,
+      // so it stays within that square around its center.
+      //
+      static SDL_Rect ImageBounds(const ImageCommand& cmd)
+      {
+        if (cmd.Angle == 0)
+        {
+          return cmd.Dst;
+        }
+
+        int half = (cmd.Dst.w + cmd.Dst.h) / 2 + 1;
+
+        int cx = cmd.Dst.x + cmd.Dst.w / 2;
+        int cy = cmd.Dst.y + cmd.Dst.h / 2;
+
+        return { cx - half, cy - half, 2 * half, 2 * half };
+      }
+
+      // =======================================================================
+
+      ///
+      /// Consecutive sprites of the same texture go out with one
+      /// SDL_RenderGeometry() call where possible (SDL 2.0.18+),
+      /// rotated ones and older SDL use SDL_RenderCopyEx().
+      ///
+      void DrawSprites()
+      {
+        //
+        // Unsubmitted batch is drawn as is.
+        //
+        _spritesRecording = false;
+
+        SDL_Texture* tintedTexture = nullptr;
+        uint32_t textureTint       = Colors::White;
+
+        for (auto& cmd : _spriteQueue)
+        {
+          if (cmd.Texture != tintedTexture)
+          {
+            FlushSprites(tintedTexture, textureTint);
+
+            if (tintedTexture != nullptr && textureTint != Colors::White)
+            {
+              SetColorMod(tintedTexture, 255, 255, 255);
+            }
+
+            tintedTexture = cmd.Texture;
+            textureTint   = Colors::White;
+          }
+
+          #if SDL_VERSION_ATLEAST(2, 0, 18)
+          if (cmd.Angle == 0)
+          {
+            QueueSprite(cmd);
+            continue;
+          }
+
+          FlushSprites(cmd.Texture, textureTint);
+          #endif
+
+          if (cmd.Tint != textureTint)
+          {
+            SetColorMod(cmd.Texture,
+                        (cmd.Tint & kMaskR) >> 16,
+                        (cmd.Tint & kMaskG) >> 8,
+                        (cmd.Tint & kMaskB));
+            textureTint = cmd.Tint;
+          }
+
+          RenderCopyEx(cmd.Texture,
+                       &cmd.Src,
+                       &cmd.Dst,
+                       cmd.Angle,
+                       nullptr,
+                       cmd.Flip);
+        }
+
+        FlushSprites(tintedTexture, textureTint);
+
+        if (tintedTexture != nullptr && textureTint != Colors::White)
+        {
+          SetColorMod(tintedTexture, 255, 255, 255);
+        }
+
+        _spriteQueue.clear();
+        _spriteBatchStart = 0;
+      }
+
+      // =======================================================================
+
+      /// @param[in,out] textureTint Current color mod of tex.
+      void FlushSprites(SDL_Texture* tex, uint32_t& textureTint)
+      {
+        #if SDL_VERSION_ATLEAST(2, 0, 18)
+        if (_spriteIndices.empty())
+        {
+          return;
+        }
+
+        //
+        // Tint is in vertex colors.
+        //
+        if (textureTint != Colors::White)
+        {
+          SetColorMod(tex, 255, 255, 255);
+          textureTint = Colors::White;
+        }
+
+        RenderGeometry(tex,
+                       _spriteVertices.data(),
+                       _spriteVertices.size(),
+                       _spriteIndices.data(),
+                       _spriteIndices.size());
+
+        _spriteVertices.clear();
+        _spriteIndices.clear();
+        #else
+        (void)tex;
+        (void)textureTint;
+        #endif
+      }
+
+      // =======================================================================
+
+      #if SDL_VERSION_ATLEAST(2, 0, 18)
+      void QueueSprite(const SpriteCommand& cmd)
+      {
+        float u1 = cmd.U1;
+        float v1 = cmd.V1;
+        float u2 = cmd.U2;
+        float v2 = cmd.V2;
+
+        if (cmd.Flip & SDL_FLIP_HORIZONTAL)
+        {
+          std::swap(u1, u2);
+        }
+
+        if (cmd.Flip & SDL_FLIP_VERTICAL)
+        {
+          std::swap(v1, v2);
+        }
+
+        float x1 = cmd.Dst.x;
+        float y1 = cmd.Dst.y;
+        float x2 = cmd.Dst.x + cmd.Dst.w;
+        float y2 = cmd.Dst.y + cmd.Dst.h;
+
+        SDL_Vertex v;
+        v.color.r = (cmd.Tint & kMaskR) >> 16;
+        v.color.g = (cmd.Tint & kMaskG) >> 8;
+        v.color.b = (cmd.Tint & kMaskB);
+        v.color.a = 255;
+
+        int base = _spriteVertices.size();
+
+        v.position  = { x1, y1 };
+        v.tex_coord = { u1, v1 };
+        _spriteVertices.push_back(v);
+
+        v.position  = { x2, y1 };
+        v.tex_coord = { u2, v1 };
+        _spriteVertices.push_back(v);
+
+        v.position  = { x1, y2 };
+        v.tex_coord = { u1, v2 };
+        _spriteVertices.push_back(v);
+
+        v.position  = { x2, y2 };
+        v.tex_coord = { u2, v2 };
+        _spriteVertices.push_back(v);
+
+        _spriteIndices.push_back(base);
+        _spriteIndices.push_back(base + 1);
+        _spriteIndices.push_back(base + 2);
+        _spriteIndices.push_back(base + 2);
+        _spriteIndices.push_back(base + 1);
+        _spriteIndices.push_back(base + 3);
+      }
+
+      // =======================================================================
+
+      std::vector<SDL_Vertex> _spriteVertices;
+      std::vector<int> _spriteIndices;
+      #endif
+
+      std::vector<SpriteCommand> _spriteQueue;
+
+      size_t _spriteBatchStart = 0;
+      bool _spritesRecording   = false;
+
+      // =======================================================================
+
+      std::vector<ImageCommand> _imageQueue;
+
+      //
+      // GroupImagesByTexture() reorders _imageQueue into it.
+      //
+      std::vector<ImageCommand> _groupedImages;
+
+      TintedTilesetCache _tintCache;
+
+      //
+      // Gets DrawImage() calls with image handle and DrawSprite()
+      // calls while printer is being recorded.
+      //
+      FrameRecorder* _imageRecorder = nullptr;
+
+      #ifdef PRINTER_STATS
+      //
+      // Draw calls of the frame being rendered
+      // and tint cache counters when it started.
+      //
+      FrameStats _counters;
+      TintCacheStats _tintStatsAtFrameStart;
+      #endif
+
+      std::vector<TileCommand> _fgCommands;
+
+      std::vector<FillCommand> _fillCommands;
+      std::vector<SDL_Rect> _fillRects;
+
+      //
+      // RenderMode::Software target,
+      // _pixels are uploaded here.
+      //
+      SDL_Texture* _softwareTexture = nullptr;
+
+      // =======================================================================
+
+      #if SDL_VERSION_ATLEAST(2, 0, 18)
+      ///
+      /// Adds tile quad tinted with _convertedHtml to the batch.
+      /// Tiles past the tileset are skipped like in other modes.
+      ///
+      void QueueTile(int x, int y, int tileIndex)
+      {
+        if (tileIndex < 0 || tileIndex >= (int)_glyphCount)
+        {
+          return;
+        }
+
+        SDL_Rect tile = TileRect(tileIndex);
+
+        float u1 = tile.x / (float)_font->Width;
+        float v1 = tile.y / (float)_font->Height;
+        float u2 = (tile.x + tile.w) / (float)_font->Width;
+        float v2 = (tile.y + tile.h) / (float)_font->Height;
+
+        float x1 = x;
+        float y1 = y;
+        float x2 = x + _tileWidthScaled;
+        float y2 = y + _tileHeightScaled;
+
+        SDL_Vertex v;
+        v.color.r = _convertedHtml.R;
+        v.color.g = _convertedHtml.G;
+        v.color.b = _convertedHtml.B;
+        v.color.a = 255;
+
+        int base = _vertices.size();
+
+        v.position  = { x1, y1 };
+        v.tex_coord = { u1, v1 };
+        _vertices.push_back(v);
+
+        v.position  = { x2, y1 };
+        v.tex_coord = { u2, v1 };
+        _vertices.push_back(v);
+
+        v.position  = { x1, y2 };
+        v.tex_coord = { u1, v2 };
+        _vertices.push_back(v);
+
+        v.position  = { x2, y2 };
+        v.tex_coord = { u2, v2 };
+        _vertices.push_back(v);
+
+        _indices.push_back(base);
+        _indices.push_back(base + 1);
+        _indices.push_back(base + 2);
+        _indices.push_back(base + 2);
+        _indices.push_back(base + 1);
+        _indices.push_back(base + 3);
+      }
+
+      // =======================================================================
+
+      std::vector<SDL_Vertex> _vertices;
+      std::vector<int> _indices;
+      #endif
+
+      RenderMode _renderMode = RenderMode::Immediate;
+
+      //
+      // Set by SetRenderMode(), target of the new mode
+      // doesn't have current frame yet.
+      //
+      bool _redrawRequested = false;
+
+      //
+      // Renderer state to restore after drawing into framebuffer texture.
+      //
+      SDL_Color _savedColor = { 0, 0, 0, 0 };
+      SDL_BlendMode _savedBlendMode = SDL_BLENDMODE_NONE;
+
+      // =======================================================================
+
+      void ConvertHtmlToRGB(const uint32_t& htmlColor)
+      {
+        _convertedHtml.R = ((htmlColor & kMaskR) >> 16);
+        _convertedHtml.G = ((htmlColor & kMaskG) >> 8);
+        _convertedHtml.B = (htmlColor & kMaskB);
+      }
+
+
+      // =======================================================================
+
+      //
+      // Here lies data after last ConvertHtmlToRGB() call.
+      //
+      TileColor _convertedHtml;
+  };
+#endif
+
+  // ===========================================================================
+
+  ///
+  /// Backend independent part: framebuffer, drawing into it
+  /// and finding cells changed since last Render().
+  /// Calls to backend are resolved at compile time.
+  ///
+  /// Backend provides Init(...), kTransparentBlank, kBlackAndWhite,
+  /// kCP437Frames, kPixelHeader (window header is centered
+  /// as if by pixels and snapped to the cell on the left),
+  /// _terminalWidth and _terminalHeight set by Init()
+  /// and gets frame through:
+  ///
+  ///   bool BeginFrame(bool forceRedraw) - returns whether every cell
+  ///                                       has to be drawn
+  ///   void DrawRun(row, x, y, count, stats) - same colored changed cells
+  ///                                           row[x] .. row[x + count - 1]
+  ///   void EndFrame(stats)
+  ///   void OnClear()
+  ///
+  /// Public API of the backend (e.g. images in SDL) is available as is.
+  ///
+  template <typename Backend>
+  class BasicPrinter : public Backend
+  {
+    public:
+      static const int kAlignLeft   = 0;
+      static const int kAlignCenter = 1;
+      static const int kAlignRight  = 2;
+
+      /// Takes the same parameters as Backend::Init().
+      template <typename ... Args>
+      bool Init(Args&& ... args)
+      {
+        if (!Backend::Init(std::forward<Args>(args)...))
+        {
+          return false;
+        }
+
+        PrepareFrameBuffer();
+
+        return true;
+      }
+
+      // =======================================================================
+
+      /// Clears framebuffer
+      /// Use this before all PrintFB calls
+      void Clear()
+      {
+        PRINTER_TRACE_SCOPE("Clear");
+
+        #ifdef PRINTER_STATS
+        auto start = std::chrono::steady_clock::now();
+        #endif
+
+        std::fill(_frameBuffer.begin(), _frameBuffer.end(), BlankCell());
+
+        Backend::OnClear();
+
+        #ifdef PRINTER_STATS
+        _clearEnd = std::chrono::steady_clock::now();
+        _drawStats.ClearTime = Microseconds(start, _clearEnd);
+        #endif
+      }
+
+      // =======================================================================
+
+      /// Prints framebuffer contents to the screen
+      /// Call this after all PrintFB calls
+      void Render()
+      {
+        PRINTER_TRACE_SCOPE("Render");
+
+        #ifdef PRINTER_STATS
+        auto start = std::chrono::steady_clock::now();
+
+        //
+        // Drawing counters of this frame go out with it.
+        //
+        _drawStats.DrawTime = Microseconds(_clearEnd, start);
+
+        _frameStats = _drawStats;
+        _drawStats  = FrameStats();
+        #endif
+
+        _frameStats.CellsEmitted = 0;
+        _frameStats.RunsEmitted  = 0;
+
+        _forceRedraw = Backend::BeginFrame(_forceRedraw);
+
+        for (int y = 0; y < _terminalHeight; y++)
+        {
+          const FBPixel* row    = &_frameBuffer[y * _terminalWidth];
+          FBPixel* presentedRow = &_presentedFrameBuffer[y * _terminalWidth];
+
+          if (not _forceRedraw
+           && std::memcmp(row,
+                          presentedRow,
+                          _terminalWidth * sizeof(FBPixel)) == 0)
+          {
+            continue;
+          }
+
+          int x = 0;
+          while (x < _terminalWidth)
+          {
+            //
+            // Cell is already on the screen since last frame.
+            //
+            if (not _forceRedraw && row[x] == presentedRow[x])
+            {
+              x++;
+              continue;
+            }
+
+            //
+            // Collect changed cells of the same color to the right
+            // and give them to backend all at once.
+            //
+            int runStart = x;
+
+            while (x < _terminalWidth
+                && row[x].ColorKey == row[runStart].ColorKey
+                && (_forceRedraw || row[x] != presentedRow[x]))
+            {
+              presentedRow[x] = row[x];
+              x++;
+            }
+
+            Backend::DrawRun(row, runStart, y, x - runStart, _frameStats);
+
+            _frameStats.CellsEmitted += (x - runStart);
+          }
+        }
+
+        _forceRedraw = false;
+
+        Backend::EndFrame(_frameStats);
 
-        if (htmlColorBg != Colors::None)
+        #ifdef PRINTER_STATS
+        _frameStats.RenderTime = Microseconds(start,
+                                              std::chrono::steady_clock::now());
+        #endif
+
+        if (_recorder != nullptr)
         {
-          ConvertHtmlToRGB(htmlColorBg);
-          SDL_SetTextureColorMod(_tileset,
-                                 _convertedHtml.R,
-                                 _convertedHtml.G,
-                                 _convertedHtml.B);
-          DrawTile(posX, posY, 219);
+          _recorder->AddFrame(_frameBuffer, _terminalWidth, _terminalHeight);
         }
 
-        ConvertHtmlToRGB(htmlColorFg);
-        SDL_SetTextureColorMod(_tileset,
-                               _convertedHtml.R,
-                               _convertedHtml.G,
-                               _convertedHtml.B);
-        DrawTile(posX, posY, image);
+        if (_castWriter != nullptr)
+        {
+          _castWriter->AddFrame(_frameBuffer, _terminalWidth, _terminalHeight);
+        }
       }
 
       // =======================================================================
 
-      void PrintFB(const int& x,
-                   const int& y,
-                   const std::string& text,
-                   int align,
-                   const uint32_t& htmlColorFg,
-                   const uint32_t& htmlColorBg = Colors::Black)
-      {
-        int px = x * _tileWidthScaled;
-        int py = y * _tileHeightScaled;
-
-        switch (align)
-        {
-          case kAlignCenter:
-          {
-            int pixelWidth = text.length() * _tileWidthScaled;
-            px -= pixelWidth / 2;
-          }
-          break;
+      int TerminalWidth()  { return _terminalWidth;  }
+      int TerminalHeight() { return _terminalHeight; }
 
-          case kAlignRight:
-          {
-            int pixelWidth = text.length() * _tileWidthScaled;
-            px -= pixelWidth;
-          }
-          break;
-        }
+      const FrameStats& GetFrameStats() { return _frameStats; }
 
-        for (auto& c : text)
-        {
-          if (htmlColorBg != Colors::None)
-          {
-            ConvertHtmlToRGB(htmlColorBg);
-            SDL_SetTextureColorMod(_tileset,
-                                   _convertedHtml.R,
-                                   _convertedHtml.G,
-                                   _convertedHtml.B);
-            DrawTile(px, py, 219);
-          }
+      /// Frame as of last Render(), row by row: [y * TerminalWidth() + x]
+      const std::vector<FBPixel>& Cells() { return _presentedFrameBuffer; }
 
-          ConvertHtmlToRGB(htmlColorFg);
-          SDL_SetTextureColorMod(_tileset,
-                                 _convertedHtml.R,
-                                 _convertedHtml.G,
-                                 _convertedHtml.B);
-          DrawTile(px, py, c);
+      // =======================================================================
 
-          px += _tileWidthScaled;
-        }
+      /// Forces next Render() to redraw every cell,
+      /// e.g. after screen was cleared or overwritten outside of Printer
+      /// or after SDL_RENDER_TARGETS_RESET event.
+      void Invalidate()
+      {
+        _forceRedraw = true;
       }
 
       // =======================================================================
 
-      void DrawImage(const int& x,
-                     const int& y,
-                     SDL_Texture* tex)
+      /// Every Render() after this call goes to recorder
+      /// (and DrawImage() calls with image handle
+      /// and DrawSprite() calls too, SDL only)
+      /// until SetRecorder(nullptr).
+      void SetRecorder(FrameRecorder* recorder)
       {
-        int tw, th;
-        SDL_QueryTexture(tex, nullptr, nullptr, &tw, &th);
-
-        SDL_Rect src;
-        src.x = 0;
-        src.y = 0;
-        src.w = tw;
-        src.h = th;
-
-        SDL_Rect dst;
-        dst.x = x;
-        dst.y = y;
-        dst.w = tw;
-        dst.h = th;
+        _recorder = recorder;
+        SetImageRecorder(static_cast<Backend&>(*this), recorder);
+      }
 
-        if (SDL_GetRenderTarget(_rendererRef) == nullptr)
-        {
-          SDL_SetRenderTarget(_rendererRef, _frameBuffer);
-        }
+      // =======================================================================
 
-        SDL_RenderCopy(_rendererRef, tex, &src, &dst);
+      /// Every Render() after this call also goes to cast writer
+      /// until SetCastWriter(nullptr).
+      void SetCastWriter(CastWriter* writer)
+      {
+        _castWriter = writer;
       }
 
       // =======================================================================
 
-      int LoadImage(const std::string& fname)
+      /// Replaces framebuffer with the next frame of recording,
+      /// call Render() to show it. Clipping doesn't apply,
+      /// frame is cut if terminal is smaller than the recorded one.
+      /// Recorded images are loaded on this printer and unloaded
+      /// by player's Close(). Returns false at the end of recording.
+      bool DrawRecordedFrame(FramePlayer& player)
       {
-        int ret = -1;
+        PRINTER_TRACE_SCOPE("DrawRecordedFrame");
 
-        SDL_Surface* surf = SDL_LoadBMP(fname.data());
-        if (surf == nullptr)
+        if (not player.NextFrame())
         {
-          printf("Couldn't load image %s: %s\n", fname.data(), SDL_GetError());
-          return ret;
+          return false;
         }
 
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(_rendererRef, surf);
-        if (tex == nullptr)
+        int w = std::min(_terminalWidth,  player.Width());
+        int h = std::min(_terminalHeight, player.Height());
+
+        const std::vector<FBPixel>& cells = player.Cells();
+
+        for (int y = 0; y < h; y++)
         {
-          printf("Couldn't create texture from surface: %s\n", SDL_GetError());
-          return ret;
+          auto row = cells.begin() + y * player.Width();
+          std::copy(row, row + w, _frameBuffer.begin() + y * _terminalWidth);
         }
 
-        _images.push_back(tex);
-
-        ret = _images.size() - 1;
+        #ifdef PRINTER_STATS
+        _drawStats.CellsWritten += w * h;
+        #endif
 
-        SDL_FreeSurface(surf);
+        DrawRecordedImages(static_cast<Backend&>(*this), player);
 
-        return ret;
+        return true;
       }
 
       // =======================================================================
 
-      int LoadImage(const std::string& fname, uint32_t colorKey)
+      /// Print to "framebuffer"
+      /// @param[in] ch CP437 glyph below 256, Unicode code point
+      ///               up to kMaxCharacter otherwise. Bigger values,
+      ///               ncurses attributes included (e.g. ACS_* chars
+      ///               with A_ALTCHARSET), aren't drawn, the first
+      ///               one is reported to stderr.
+      ///               ncurses backend shows characters above 0xFF
+      ///               as '?'.
+      /// @param[in] htmlColorBg Colors::None keeps cell's background.
+      void PrintFB(const int& x,
+                   const int& y,
+                   const int& ch,
+                   const uint32_t& htmlColorFg,
+                   const uint32_t& htmlColorBg = Colors::Black)
       {
-        int ret = -1;
-
-        SDL_Surface* surf = SDL_LoadBMP(fname.data());
-        if (surf == nullptr)
-        {
-          printf("Couldn't load image %s: %s\n", fname.data(), SDL_GetError());
-          return ret;
-        }
+        PRINTER_TRACE_BATCH("PrintFB");
 
-        uint32_t r = ((colorKey & _maskR) >> 16);
-        uint32_t g = ((colorKey & _maskG) >> 8);
-        uint32_t b = (colorKey & _maskB);
+        #ifdef PRINTER_STATS
+        _drawStats.PrintCalls++;
+        #endif
 
-        int ok = SDL_SetColorKey(surf, SDL_TRUE, SDL_MapRGB(surf->format, r, g, b));
-        if (ok == -1)
+        if (not CharacterFits(ch, __PRETTY_FUNCTION__))
         {
-          printf("Couldn't set color key: %s\n", SDL_GetError());
-          return ret;
+          return;
         }
 
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(_rendererRef, surf);
-        if (tex == nullptr)
+        if (x < _clip.X1 || x >= _clip.X2
+         || y < _clip.Y1 || y >= _clip.Y2)
         {
-          printf("Couldn't create texture from surface: %s\n", SDL_GetError());
-          return ret;
+          return;
         }
 
-        _images.push_back(tex);
-
-        ret = _images.size() - 1;
-
-        SDL_FreeSurface(surf);
-
-        return ret;
+        SetCell(_frameBuffer[y * _terminalWidth + x],
+                ch,
+                htmlColorFg,
+                htmlColorBg);
       }
 
       // =======================================================================
 
-      void DrawImage(int imageIndex,
-                     const SDL_Rect& r,
-                     int angle,
-                     SDL_RendererFlip flip = SDL_RendererFlip::SDL_FLIP_NONE)
+      /// Bytes of text are CP437 glyphs.
+      /// Right aligned text ends at x.
+      void PrintFB(const int& x,
+                   const int& y,
+                   const std::string& text,
+                   int align,
+                   const uint32_t& htmlColorFg,
+                   const uint32_t& htmlColorBg = Colors::Black)
       {
-        if (imageIndex < 0 or imageIndex > (int)_images.size() - 1)
+        PRINTER_TRACE_BATCH("PrintFB");
+
+        #ifdef PRINTER_STATS
+        _drawStats.PrintCalls++;
+        #endif
+
+        if (y < _clip.Y1 || y >= _clip.Y2)
         {
           return;
         }
 
-        SDL_Texture* t = _images[imageIndex];
+        int px = x;
 
-        int tw, th;
-        int ok = SDL_QueryTexture(t, nullptr, nullptr, &tw, &th);
-        if (ok == -1)
+        switch (align)
         {
-          printf("Couldn't query texture: %s\n", SDL_GetError());
-          return;
+          case kAlignCenter:
+            px -= text.length() / 2;
+            break;
+
+          case kAlignRight:
+            px -= (int)text.length() - 1;
+            break;
+
+          // Defaulting to left alignment
+          default:
+            break;
         }
 
-        SDL_Rect src;
-        src.x = 0;
-        src.y = 0;
-        src.w = tw;
-        src.h = th;
+        //
+        // Only the part of the string inside clip rectangle is written.
+        //
+        int from = std::max(px, _clip.X1);
+        int to   = std::min(px + (int)text.length(), _clip.X2);
 
-        SDL_Rect dst;
-        dst.x = r.x;
-        dst.y = r.y;
-        dst.w = r.w;
-        dst.h = r.h;
+        FBPixel* row = &_frameBuffer[y * _terminalWidth];
 
-        if (SDL_GetRenderTarget(_rendererRef) == nullptr)
+        for (int i = from; i < to; i++)
         {
-          SDL_SetRenderTarget(_rendererRef, _frameBuffer);
+          SetCell(row[i],
+                  (unsigned char)text[i - px],
+                  htmlColorFg,
+                  htmlColorBg);
         }
+      }
+
+      // =======================================================================
+
+      /// Drawing is limited to the rectangle (in cells) until PopClip().
+      /// Nested rectangle is intersected with the current one.
+      void PushClip(int x, int y, int w, int h)
+      {
+        _clipStack.push_back(_clip);
 
-        SDL_RenderCopyEx(_rendererRef, t, &src, &dst, angle, nullptr, flip);
+        _clip.X1 = std::max(_clip.X1, x);
+        _clip.Y1 = std::max(_clip.Y1, y);
+        _clip.X2 = std::min(_clip.X2, x + w);
+        _clip.Y2 = std::min(_clip.Y2, y + h);
       }
 
       // =======================================================================
 
-      void DrawImage(int imageIndex,
-                     const SDL_Rect& r)
+      void PopClip()
       {
-        if (imageIndex < 0 or imageIndex > (int)_images.size() - 1)
+        if (_clipStack.empty())
         {
+          printf("%s - clip stack is empty!\n", __PRETTY_FUNCTION__);
           return;
         }
 
-        SDL_Texture* t = _images[imageIndex];
+        _clip = _clipStack.back();
+        _clipStack.pop_back();
+      }
 
-        int tw, th;
-        int ok = SDL_QueryTexture(t, nullptr, nullptr, &tw, &th);
-        if (ok == -1)
+      // =======================================================================
+
+      /// Calls transform(FBPixel& cell, int x, int y) for every cell
+      /// of w x h area at (x, y) inside clip rectangle, e.g. to fade
+      /// what's already drawn without printing it again:
+      ///
+      ///   printer.TransformCells(0, 0, w, h,
+      ///   [](TG::FBPixel& c, int, int)
+      ///   {
+      ///     c.ColorKey = TG::PackColorKey(TG::ScaleColor(TG::GetKeyFg(c.ColorKey), 128),
+      ///                                   TG::ScaleColor(TG::GetKeyBg(c.ColorKey), 128));
+      ///   });
+      template <typename Transform>
+      void TransformCells(int x, int y, int w, int h, Transform transform)
+      {
+        int x1 = std::max(x, _clip.X1);
+        int y1 = std::max(y, _clip.Y1);
+        int x2 = std::min(x + w, _clip.X2);
+        int y2 = std::min(y + h, _clip.Y2);
+
+        if (x1 >= x2 || y1 >= y2)
         {
-          printf("Couldn't query texture: %s\n", SDL_GetError());
           return;
         }
 
-        SDL_Rect src;
-        src.x = 0;
-        src.y = 0;
-        src.w = tw;
-        src.h = th;
-
-        SDL_Rect dst;
-        dst.x = r.x;
-        dst.y = r.y;
-        dst.w = r.w;
-        dst.h = r.h;
+        #ifdef PRINTER_STATS
+        _drawStats.CellsWritten += (x2 - x1) * (y2 - y1);
+        #endif
 
-        if (SDL_GetRenderTarget(_rendererRef) == nullptr)
+        for (int j = y1; j < y2; j++)
         {
-          SDL_SetRenderTarget(_rendererRef, _frameBuffer);
-        }
+          FBPixel* row = &_frameBuffer[j * _terminalWidth];
 
-        SDL_RenderCopy(_rendererRef, t, &src, &dst);
+          for (int i = x1; i < x2; i++)
+          {
+            transform(row[i], i, j);
+          }
+        }
       }
 
       // =======================================================================
 
-      void DrawImage(const int& x,
-                     const int& y,
-                     const int& w,
-                     const int& h,
-                     SDL_Texture* tex)
+      /// Fills w x h cells starting at (x, y).
+      /// @param[in] ch Same range as in PrintFB().
+      /// @param[in] htmlColorBg Colors::None keeps cells' background.
+      void FillRect(int x,
+                    int y,
+                    int w,
+                    int h,
+                    int ch,
+                    const uint32_t& htmlColorFg,
+                    const uint32_t& htmlColorBg = Colors::Black)
       {
-        int tw, th;
-        SDL_QueryTexture(tex, nullptr, nullptr, &tw, &th);
-
-        SDL_Rect src;
-        src.x = 0;
-        src.y = 0;
-        src.w = tw;
-        src.h = th;
-
-        SDL_Rect dst;
-        dst.x = x;
-        dst.y = y;
-        dst.w = w;
-        dst.h = h;
+        int y1 = std::max(y, _clip.Y1);
+        int y2 = std::min(y + h, _clip.Y2);
 
-        if (SDL_GetRenderTarget(_rendererRef) == nullptr)
+        for (int j = y1; j < y2; j++)
         {
-          SDL_SetRenderTarget(_rendererRef, _frameBuffer);
+          FillSpan(x, x + w, j, ch, htmlColorFg, htmlColorBg);
         }
+      }
+
+      // =======================================================================
 
-        SDL_RenderCopy(_rendererRef, tex, &src, &dst);
+      /// Horizontal line of length cells to the right of (x, y).
+      void HLine(int x,
+                 int y,
+                 int length,
+                 int ch,
+                 const uint32_t& htmlColorFg,
+                 const uint32_t& htmlColorBg = Colors::Black)
+      {
+        FillSpan(x, x + length, y, ch, htmlColorFg, htmlColorBg);
       }
 
       // =======================================================================
 
-      void DrawWindow(const Position& leftCorner,
-                      const Position& size,
-                      const std::string& header = std::string{},
-                      const uint32_t& headerFgColor = Colors::White,
-                      const uint32_t& headerBgColor = Colors::Black,
-                      const uint32_t& borderColor = Colors::White,
-                      const uint32_t& borderBgColor = Colors::Black,
-                      const uint32_t& bgColor = Colors::Black,
-                      int variant = 0)
+      /// Vertical line of length cells down from (x, y).
+      void VLine(int x,
+                 int y,
+                 int length,
+                 int ch,
+                 const uint32_t& htmlColorFg,
+                 const uint32_t& htmlColorBg = Colors::Black)
       {
-        auto res = GetPerimeter(leftCorner.X,
-                                leftCorner.Y,
-                                size.X,
-                                size.Y,
-                                true);
+        FillColumn(x, y, y + length, ch, htmlColorFg, htmlColorBg);
+      }
 
-        int x = leftCorner.X;
-        int y = leftCorner.Y;
+      // =======================================================================
+
+      /// Frame around w x h cells area starting at (x, y), inside isn't touched.
+      /// Drawn with CP437 box characters if backend's font
+      /// has them (variant selects the set) or with '+', '-' and '|'.
+      void Box(int x,
+               int y,
+               int w,
+               int h,
+               const uint32_t& htmlColorFg,
+               const uint32_t& htmlColorBg = Colors::Black,
+               int variant = 0)
+      {
+        if (w <= 0 || h <= 0)
+        {
+          return;
+        }
 
         int ulCorner;
         int urCorner;
@@ -879,7 +6151,19 @@ namespace TG
         int vBarL;
         int vBarR;
 
-        if (variant == 0)
+        if (not Backend::kCP437Frames)
+        {
+          ulCorner = '+';
+          urCorner = '+';
+          dlCorner = '+';
+          drCorner = '+';
+
+          hBarU = '-';
+          hBarD = '-';
+          vBarL = '|';
+          vBarR = '|';
+        }
+        else if (variant == 0)
         {
           ulCorner = CP437IndexByType.at(NameCP437::ULCORNER_2);
           urCorner = CP437IndexByType.at(NameCP437::URCORNER_2);
@@ -904,2313 +6188,473 @@ namespace TG
           vBarR = CP437IndexByType.at(NameCP437::VBAR_3R);
         }
 
-        // Fill background
-
-        for (int i = x + 1; i < x + size.X; i++)
-        {
-          for (int j = y + 1; j < y + size.Y; j++)
-          {
-            PrintFB(i, j, ' ', Colors::Black, bgColor);
-          }
-        }
+        int x2 = x + w - 1;
+        int y2 = y + h - 1;
 
         // Corners
 
-        PrintFB(x,          y,          ulCorner, borderColor, borderBgColor);
-        PrintFB(x + size.X, y,          urCorner, borderColor, borderBgColor);
-        PrintFB(x,          y + size.Y, dlCorner, borderColor, borderBgColor);
-        PrintFB(x + size.X, y + size.Y, drCorner, borderColor, borderBgColor);
+        PrintFB(x,  y,  ulCorner, htmlColorFg, htmlColorBg);
+        PrintFB(x2, y,  urCorner, htmlColorFg, htmlColorBg);
+        PrintFB(x,  y2, dlCorner, htmlColorFg, htmlColorBg);
+        PrintFB(x2, y2, drCorner, htmlColorFg, htmlColorBg);
 
         // Horizontal bars
 
-        for (int i = x + 1; i < x + size.X; i++)
-        {
-          PrintFB(i, y,          hBarU, borderColor, borderBgColor);
-          PrintFB(i, y + size.Y, hBarD, borderColor, borderBgColor);
-        }
+        HLine(x + 1, y,  w - 2, hBarU, htmlColorFg, htmlColorBg);
+        HLine(x + 1, y2, w - 2, hBarD, htmlColorFg, htmlColorBg);
 
         // Vertical bars
 
-        for (int i = y + 1; i < y + size.Y; i++)
-        {
-          PrintFB(x,          i, vBarL, borderColor, borderBgColor);
-          PrintFB(x + size.X, i, vBarR, borderColor, borderBgColor);
-        }
-
-        if (header.length() != 0)
-        {
-          std::string lHeader = header;
-          lHeader.insert(0, " ");
-          lHeader.append(" ");
-
-          int stringPixelWidth = (lHeader.length() * _tileWidthScaled);
-          int headerPosX = x * _tileWidthScaled;
-          int headerPosY = y * _tileHeightScaled;
-
-          // size.X actually gives + 1 (see corners section of PrintFBs above),
-          // so if size.X = 4 it means span from x to x + 4 end point.
-          // Thus, we either must align to string.length() / 2, or
-          // adjust header's position by adding additional _tileWidthScaled / 2,
-          // depending on size.X
-          //
-          // It's too long to explain thoroughly,
-          // just open some graphics editor and see for yourself.
-
-          if (size.X % 2 != 0)
-          {
-            int toAdd = ((size.X + 1) / 2) * _tileWidthScaled;
-            headerPosX += toAdd;
-            headerPosX -= stringPixelWidth / 2;
-          }
-          else
-          {
-            int toAdd = (size.X / 2) * _tileWidthScaled;
-            headerPosX += toAdd;
-            headerPosX -= stringPixelWidth / 2;
-            headerPosX += _tileWidthScaled / 2;
-          }
-
-          for (auto& c : lHeader)
-          {
-            ConvertHtmlToRGB(headerBgColor);
-            SDL_SetTextureColorMod(_tileset,
-                                   _convertedHtml.R,
-                                   _convertedHtml.G,
-                                   _convertedHtml.B);
-            DrawTile(headerPosX, headerPosY, 219);
-
-            ConvertHtmlToRGB(headerFgColor);
-            SDL_SetTextureColorMod(_tileset,
-                                   _convertedHtml.R,
-                                   _convertedHtml.G,
-                                   _convertedHtml.B);
-            DrawTile(headerPosX, headerPosY, c);
-
-            headerPosX += _tileWidthScaled;
-          }
-        }
-      }
-  #endif
-
-    private:
-      // Width and height of the window in characters
-      int _terminalWidth;
-      int _terminalHeight;
-
-      const uint32_t _maskR = 0x00FF0000;
-      const uint32_t _maskG = 0x0000FF00;
-      const uint32_t _maskB = 0x000000FF;
-
-      template<typename ... Args>
-      std::string StringFormat(const std::string& format, Args ... args)
-      {
-        size_t size = snprintf(nullptr,
-                               0,
-                               format.c_str(),
-                               args ...);
-        std::string s;
-
-        if (!size)
-        {
-          return s;
-        }
-
-        s.resize(size);
-        char *buf = (char *)s.data();
-        snprintf(buf, size + 1, format.c_str(), args ...);
-        return s;
-      }
-
-  #ifndef USE_SDL
-      bool ContainsColorMap(size_t hashToCheck)
-      {
-        return (_colorMap.count(hashToCheck) == 1);
+        VLine(x,  y + 1, h - 2, vBarL, htmlColorFg, htmlColorBg);
+        VLine(x2, y + 1, h - 2, vBarR, htmlColorFg, htmlColorBg);
       }
 
       // =======================================================================
 
-      bool ColorIndexExists(size_t hashToCheck)
+      /// Box() with filled inside and optional header.
+      /// Right and bottom borders are at leftCorner + size.
+      void DrawWindow(const Position& leftCorner,
+                      const Position& size,
+                      const std::string& header = std::string{},
+                      const uint32_t& headerFgColor = Colors::White,
+                      const uint32_t& headerBgColor = Colors::Black,
+                      const uint32_t& borderColor = Colors::White,
+                      const uint32_t& borderBgColor = Colors::Black,
+                      const uint32_t& bgColor = Colors::Black,
+                      int variant = 0)
       {
-        return (_colorIndexMap.count(hashToCheck) == 1);
-      }
+        PRINTER_TRACE_BATCH("DrawWindow");
 
-      // =======================================================================
+        int x = leftCorner.X;
+        int y = leftCorner.Y;
 
-      NColor GetNColor(const uint32_t& htmlColor)
-      {
-        NColor ret;
+        FillRect(x + 1,
+                 y + 1,
+                 size.X - 1,
+                 size.Y - 1,
+                 ' ',
+                 Colors::Black,
+                 bgColor);
+
+        Box(x,
+            y,
+            size.X + 1,
+            size.Y + 1,
+            borderColor,
+            borderBgColor,
+            variant);
 
-        int valueR = ((htmlColor & _maskR) >> 16);
-        int valueG = ((htmlColor & _maskG) >> 8);
-        int valueB = (htmlColor  & _maskB);
+        if (header.length() != 0)
+        {
+          std::string lHeader = header;
+          lHeader.insert(0, " ");
+          lHeader.append(" ");
 
-        //
-        // ncurses color component has range from 0 to 1000
-        //
-        int scaledValueR = (valueR / 255.0f) * 1000;
-        int scaledValueG = (valueG / 255.0f) * 1000;
-        int scaledValueB = (valueB / 255.0f) * 1000;
+          int len = (int)lHeader.length();
 
-        ret.R = scaledValueR;
-        ret.G = scaledValueG;
-        ret.B = scaledValueB;
+          int headerPosX = x + (size.X / 2) - len / 2;
 
-        return ret;
+          if (Backend::kPixelHeader)
+          {
+            // size.X actually gives + 1 (see Box() call above),
+            // so if size.X = 4 it means span from x to x + 4 end point.
+            // Window center is thus at x + (size.X + 1) / 2 cells,
+            // and header is snapped to the nearest cell to the left of
+            // where pixel perfect centering would put it,
+            // also for windows partly to the left of the screen.
+            int twice = x * 2 + size.X + 1 - len;
+
+            headerPosX = (twice >= 0) ? twice / 2 : (twice - 1) / 2;
+          }
+
+          PrintFB(headerPosX,
+                  y,
+                  lHeader,
+                  kAlignLeft,
+                  headerFgColor,
+                  headerBgColor);
+        }
       }
 
+    private:
+      using Backend::_terminalWidth;
+      using Backend::_terminalHeight;
+
+      FrameStats _frameStats;
+
       // =======================================================================
 
-      size_t GetOrSetColor(const uint32_t& htmlColorFg,
-                           const uint32_t& htmlColorBg)
+      ///
+      /// What Clear() fills the framebuffer with.
+      ///
+      FBPixel BlankCell()
       {
-        std::string fgColorStr = StringFormat("#%06X", htmlColorFg);
-        std::string bgColorStr = StringFormat("#%06X", htmlColorBg);
+        FBPixel s;
 
-        std::string composition = fgColorStr + bgColorStr;
+        s.ColorKey    = PackColorKey(Colors::Black, Colors::Black);
+        s.Character   = ' ';
+        s.Transparent = Backend::kTransparentBlank ? 1 : 0;
 
-        std::hash<std::string> hasher;
+        return s;
+      }
 
-        size_t hash = hasher(composition);
+      // =======================================================================
 
-        if (not ContainsColorMap(hash))
-        {
-          auto fg = GetNColor(htmlColorFg);
-          auto bg = GetNColor(htmlColorBg);
+      void SetCell(FBPixel& cell,
+                   int ch,
+                   const uint32_t& htmlColorFg,
+                   const uint32_t& htmlColorBg)
+      {
+        #ifdef PRINTER_STATS
+        _drawStats.CellsWritten++;
+        #endif
 
-          short hashFg = hasher(fgColorStr);
-          short hashBg = hasher(bgColorStr);
+        uint32_t fg = htmlColorFg;
+        uint32_t bg = htmlColorBg;
 
-          if (not ColorIndexExists(hashFg))
-          {
-            fg.ColorIndex = _colorGlobalIndex;
-            _colorIndexMap[hashFg] = _colorGlobalIndex++;
-            init_color(fg.ColorIndex, fg.R, fg.G, fg.B);
-          }
-          else
+        if (Backend::kBlackAndWhite)
+        {
+          if (htmlColorFg == Colors::Black
+          and htmlColorBg == Colors::Black)
           {
-            fg.ColorIndex = _colorIndexMap[hashFg];
+            fg = Colors::Black;
+            bg = Colors::Black;
           }
-
-          if (not ColorIndexExists(hashBg))
+          else if (htmlColorBg != Colors::Black)
           {
-            bg.ColorIndex = _colorGlobalIndex;
-            _colorIndexMap[hashBg] = _colorGlobalIndex++;
-            init_color(bg.ColorIndex, bg.R, bg.G, bg.B);
+            fg = Colors::Black;
+            bg = Colors::White;
           }
           else
           {
-            bg.ColorIndex = _colorIndexMap[hashBg];
+            fg = Colors::White;
+            bg = Colors::Black;
           }
+        }
 
-          ColorPair cp = { _colorPairsGlobalIndex++, fg, bg };
-          _colorMap[hash] = cp;
-
-          init_pair(_colorMap[hash].PairIndex, _colorIndexMap[hashFg], _colorIndexMap[hashBg]);
+        if (bg == Colors::None)
+        {
+          //
+          // Keep whatever background this cell already has.
+          //
+          cell.ColorKey = PackColorKey(fg, GetKeyBg(cell.ColorKey));
+        }
+        else
+        {
+          cell.ColorKey    = PackColorKey(fg, bg);
+          cell.Transparent = 0;
         }
 
-        return hash;
+        cell.Character = ch;
       }
 
       // =======================================================================
 
-      std::pair<int, int> AlignText(int x,
-                                    int y,
-                                    int align,
-                                    const std::string& text)
+      ///
+      /// Reports the first bad character to stderr, stdout is the screen.
+      ///
+      static bool CharacterFits(int ch, const char* caller)
       {
-        std::pair<int, int> res;
-
-        int tx = x;
-        int ty = y;
-
-        switch (align)
+        if (ch >= 0 && ch <= kMaxCharacter)
         {
-          case kAlignRight:
-            // We have to compensate for new position after shift.
-            //
-            // E.g., print (80, 10, kAlignRight, "Bees")
-            // will start from 76 position (tx -= text.length())
-            // so it will actually end at 76 (B), 77 (e), 78 (e), 79 (s)
-            // This way we either should not subtract 1 from TerminalWidth
-            // when printing right aligned text at the end of the screen,
-            // or make this hack.
-            tx++;
-
-            tx -= text.length();
-            break;
+          return true;
+        }
 
-          case kAlignCenter:
-            tx -= text.length() / 2;
-            break;
+        static bool reported = false;
 
-          // Defaulting to left alignment
-          default:
-            break;
+        if (not reported)
+        {
+          fprintf(stderr,
+                  "%s - character 0x%X doesn't fit into a cell "
+                  "(max 0x%X, no ncurses attributes)\n",
+                  caller,
+                  (unsigned)ch,
+                  (unsigned)kMaxCharacter);
+          reported = true;
         }
 
-        res.first = ty;
-        res.second = tx;
-
-        return res;
+        return false;
       }
 
       // =======================================================================
 
-      void PrepareFrameBuffer()
+      ///
+      /// Fills [x1, x2) of row y clipped once, not per cell.
+      ///
+      void FillSpan(int x1,
+                    int x2,
+                    int y,
+                    int ch,
+                    const uint32_t& htmlColorFg,
+                    const uint32_t& htmlColorBg)
       {
-        for (int x = 0; x < _terminalWidth; x++)
+        if (not CharacterFits(ch, __PRETTY_FUNCTION__))
         {
-          std::vector<FBPixel> row;
-
-          for (int y = 0; y < _terminalHeight; y++)
-          {
-            FBPixel s;
-
-            s.ColorPairHash = -1;
-            s.Character = ' ';
-
-            row.push_back(s);
-          }
-
-          _frameBuffer.push_back(row);
+          return;
         }
-      }
-
-      // =======================================================================
-
-      std::unordered_map<size_t, ColorPair> _colorMap;
-      std::unordered_map<size_t, short> _colorIndexMap;
 
-      short _colorPairsGlobalIndex = 1;
-      short _colorGlobalIndex = 8;
+        if (y < _clip.Y1 || y >= _clip.Y2)
+        {
+          return;
+        }
 
-      std::vector<std::vector<FBPixel>> _frameBuffer;
+        x1 = std::max(x1, _clip.X1);
+        x2 = std::min(x2, _clip.X2);
 
-      void InitForCurses()
-      {
-        int mx = 0;
-        int my = 0;
+        if (x1 >= x2)
+        {
+          return;
+        }
 
-        getmaxyx(stdscr, my, mx);
+        FBPixel* row = &_frameBuffer[y * _terminalWidth];
 
-        _terminalWidth = mx;
-        _terminalHeight = my;
+        if (htmlColorBg == Colors::None)
+        {
+          for (int i = x1; i < x2; i++)
+          {
+            SetCell(row[i], ch, htmlColorFg, htmlColorBg);
+          }
 
-        // Enforce colors of standard ncurses colors
-        // because some colors aren't actually correspond to their
-        // "names", e.g. COLOR_BLACK isn't actually black, but grey,
-        // so we redefine it.
+          return;
+        }
 
-        init_color(COLOR_BLACK, 0, 0, 0);
-        init_color(COLOR_WHITE, 1000, 1000, 1000);
-        init_color(COLOR_RED, 1000, 0, 0);
-        init_color(COLOR_GREEN, 0, 1000, 0);
-        init_color(COLOR_BLUE, 0, 0, 1000);
-        init_color(COLOR_CYAN, 0, 1000, 1000);
-        init_color(COLOR_MAGENTA, 1000, 0, 1000);
-        init_color(COLOR_YELLOW, 1000, 1000, 0);
+        //
+        // All cells of the span are the same,
+        // so make the first one and copy it.
+        //
+        SetCell(row[x1], ch, htmlColorFg, htmlColorBg);
+        std::fill(row + x1 + 1, row + x2, row[x1]);
 
-        PrepareFrameBuffer();
+        #ifdef PRINTER_STATS
+        _drawStats.CellsWritten += (x2 - x1 - 1);
+        #endif
       }
-  #else
-      bool _initialized = false;
-
-      std::vector<TileInfo> _tiles;
-      std::map<char, int> _tileIndexByChar;
-
-      SDL_Texture* _tileset = nullptr;
-      SDL_Texture* _frameBuffer = nullptr;
-      SDL_Renderer* _rendererRef = nullptr;
-
-      std::vector<SDL_Texture*> _images;
-
-      std::string _tilesetFilename;
-
-      float _globalScale = 1.0f;
-
-      int _tilesetWidth = 0;
-      int _tilesetHeight = 0;
 
-      int _tileWidth = 0;
-      int _tileHeight = 0;
-
-      int _tileWidthScaled = 0;
-      int _tileHeightScaled = 0;
-
-      int _windowWidth = 0;
-      int _windowHeight = 0;
+      // =======================================================================
 
-      bool InitForSDL(bool useEmbeddedTileset)
+      ///
+      /// Fills [y1, y2) of column x clipped once, not per cell.
+      ///
+      void FillColumn(int x,
+                      int y1,
+                      int y2,
+                      int ch,
+                      const uint32_t& htmlColorFg,
+                      const uint32_t& htmlColorBg)
       {
-        SDL_Surface* surf = nullptr;
-
-        if (!useEmbeddedTileset)
+        if (not CharacterFits(ch, __PRETTY_FUNCTION__))
         {
-          surf = SDL_LoadBMP(_tilesetFilename.data());
+          return;
+        }
 
-          if (surf)
-          {
-            SDL_SetColorKey(surf,
-                            SDL_TRUE,
-                            SDL_MapRGB(surf->format, 0xFF, 0, 0xFF));
+        if (x < _clip.X1 || x >= _clip.X2)
+        {
+          return;
+        }
 
-            _tileset = SDL_CreateTextureFromSurface(_rendererRef,
-                                                    surf);
+        y1 = std::max(y1, _clip.Y1);
+        y2 = std::min(y2, _clip.Y2);
 
-            SDL_FreeSurface(surf);
-          }
-          else
-          {
-            printf("***** Could not load tileset %s - %s!\n",
-                   _tilesetFilename.data(), SDL_GetError());
-            return false;
-          }
-        }
-        else
+        if (y1 >= y2)
         {
-          auto res   = Base64_Decode(kTileset8x16Base64);
-          auto bytes = ConvertStringToBytes(res);
+          return;
+        }
 
-          SDL_RWops* data = SDL_RWFromMem(bytes.data(),
-                                          bytes.size());
+        FBPixel* cell = &_frameBuffer[y1 * _terminalWidth + x];
 
-          surf = SDL_LoadBMP_RW(data, 1);
-          if (!surf)
+        if (htmlColorBg == Colors::None)
+        {
+          for (int j = y1; j < y2; j++, cell += _terminalWidth)
           {
-            printf("***** Could not load from memory: %s *****\n",
-                   SDL_GetError());
-            return false;
+            SetCell(*cell, ch, htmlColorFg, htmlColorBg);
           }
 
-          SDL_SetColorKey(surf,
-                          SDL_TRUE,
-                          SDL_MapRGB(surf->format, 0xFF, 0, 0xFF));
-
-          _tileset = SDL_CreateTextureFromSurface(_rendererRef,
-                                                  surf);
-          SDL_FreeSurface(surf);
+          return;
         }
 
-        _tileWidthScaled  = _tileWidth * _globalScale;
-        _tileHeightScaled = _tileHeight * _globalScale;
-
-        _terminalWidth  = _windowWidth / _tileWidthScaled;
-        _terminalHeight = _windowHeight / _tileHeightScaled;
-
-        int w = 0, h = 0;
-        SDL_QueryTexture(_tileset, nullptr, nullptr, &w, &h);
-
-        _tilesetWidth = w;
-        _tilesetHeight = h;
+        SetCell(*cell, ch, htmlColorFg, htmlColorBg);
 
-        _frameBuffer = SDL_CreateTexture(_rendererRef,
-                                         SDL_PIXELFORMAT_RGBA32,
-                                         SDL_TEXTUREACCESS_TARGET,
-                                         _windowWidth,
-                                         _windowHeight);
+        FBPixel filled = *cell;
 
-        char asciiIndex = 0;
-        int tileIndex = 0;
-        for (int y = 0; y < h; y += _tileHeight)
+        for (int j = y1 + 1; j < y2; j++)
         {
-          for (int x = 0; x < w; x += _tileWidth)
-          {
-            TileInfo ti;
-            ti.X = x;
-            ti.Y = y;
-            _tiles.push_back(ti);
-
-            _tileIndexByChar[asciiIndex] = tileIndex;
-
-            asciiIndex++;
-            tileIndex++;
-          }
+          cell += _terminalWidth;
+          *cell = filled;
         }
 
-        return true;
+        #ifdef PRINTER_STATS
+        _drawStats.CellsWritten += (y2 - y1 - 1);
+        #endif
       }
 
       // =======================================================================
 
-      void DrawTile(int x, int y, int tileIndex)
+      void PrepareFrameBuffer()
       {
-        TileInfo& tile = _tiles[tileIndex];
-
-        SDL_Rect src;
-        src.x = tile.X;
-        src.y = tile.Y;
-        src.w = _tileWidth;
-        src.h = _tileHeight;
-
-        SDL_Rect dst;
-        dst.x = x;
-        dst.y = y;
-        dst.w = _tileWidthScaled;
-        dst.h = _tileHeightScaled;
+        _frameBuffer.assign(_terminalWidth * _terminalHeight, BlankCell());
 
-        if (SDL_GetRenderTarget(_rendererRef) == nullptr)
-        {
-          SDL_SetRenderTarget(_rendererRef, _frameBuffer);
-        }
-
-        SDL_RenderCopy(_rendererRef, _tileset, &src, &dst);
-      }
-
-      // =======================================================================
+        //
+        // Nothing is on the screen yet,
+        // so first Render() will emit every cell.
+        //
+        _presentedFrameBuffer = _frameBuffer;
 
-      void ConvertHtmlToRGB(const uint32_t& htmlColor)
-      {
-        if (_validColorsCache.count(htmlColor) == 1)
-        {
-          _convertedHtml = _validColorsCache[htmlColor];
-          return;
-        }
+        _clip = { 0, 0, _terminalWidth, _terminalHeight };
+        _clipStack.clear();
 
-        _convertedHtml.R = ((htmlColor & _maskR) >> 16);
-        _convertedHtml.G = ((htmlColor & _maskG) >> 8);
-        _convertedHtml.B = (htmlColor & _maskB);
+        #ifdef PRINTER_STATS
+        _clearEnd = std::chrono::steady_clock::now();
+        #endif
 
-        _validColorsCache[htmlColor] = _convertedHtml;
+        Invalidate();
       }
 
       // =======================================================================
 
-      const std::string kBase64Chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-
       //
-      // *** https://stackoverflow.com/questions/180947/base64-decode-snippet-in-c
+      // Cells are stored row by row: [y * _terminalWidth + x]
       //
-      bool IsBase64(unsigned char c)
-      {
-        auto res = std::find(kBase64Chars.begin(),
-                             kBase64Chars.end(),
-                             c);
+      std::vector<FBPixel> _frameBuffer;
 
-        return (res != kBase64Chars.end());
-      }
+      //
+      // What was sent to the screen during last Render().
+      //
+      std::vector<FBPixel> _presentedFrameBuffer;
 
-      // =======================================================================
+      bool _forceRedraw = true;
 
-      std::string Base64_Encode(unsigned char const* bytes_to_encode,
-                                unsigned int in_len)
+      //
+      // Cells outside of [X1, X2) x [Y1, Y2) are not drawn.
+      //
+      struct ClipRect
       {
-        std::string ret;
-        int i = 0;
-        int j = 0;
-        unsigned char char_array_3[3];
-        unsigned char char_array_4[4];
+        int X1;
+        int Y1;
+        int X2;
+        int Y2;
+      };
 
-        while (in_len--)
-        {
-          char_array_3[i++] = *(bytes_to_encode++);
-          if (i == 3)
-          {
-            char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-            char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-            char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-            char_array_4[3] = char_array_3[2] & 0x3f;
+      ClipRect _clip = { 0, 0, 0, 0 };
 
-            for(i = 0; (i < 4) ; i++)
-            {
-              ret += kBase64Chars[char_array_4[i]];
-            }
+      std::vector<ClipRect> _clipStack;
 
-            i = 0;
-          }
-        }
+      FrameRecorder* _recorder = nullptr;
 
-        if (i)
-        {
-          for(j = i; j < 3; j++)
-          {
-            char_array_3[j] = '\0';
-          }
+      CastWriter* _castWriter = nullptr;
 
-          char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-          char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-          char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-          char_array_4[3] = char_array_3[2] & 0x3f;
+      // =======================================================================
 
-          for (j = 0; (j < i + 1); j++)
-          {
-            ret += kBase64Chars[char_array_4[j]];
-          }
+      //
+      // Only SDL has images to record and replay.
+      //
+      template <typename B>
+      static void SetImageRecorder(B&, FrameRecorder*)
+      {
+      }
 
-          while((i++ < 3))
-          {
-            ret += '=';
-          }
-        }
+      template <typename B>
+      static void DrawRecordedImages(B&, FramePlayer&)
+      {
+      }
 
-        return ret;
+      #ifdef USE_SDL
+      static void SetImageRecorder(SDLBackend& backend,
+                                   FrameRecorder* recorder)
+      {
+        backend.SetImageRecorder(recorder);
       }
 
       // =======================================================================
 
-      std::string Base64_Decode(const std::string& encoded_string)
+      static void DrawRecordedImages(SDLBackend& backend, FramePlayer& player)
       {
-        int in_len = encoded_string.size();
-        int i = 0;
-        int j = 0;
-        int in_ = 0;
-        unsigned char char_array_4[4], char_array_3[3];
-        std::string ret;
-
-        while (in_len-- && ( encoded_string[in_] != '=') && IsBase64(encoded_string[in_]))
+        for (const RecordedImage& img : player.Images())
         {
-          char_array_4[i++] = encoded_string[in_]; in_++;
-          if (i ==4)
-          {
-            for (i = 0; i <4; i++)
-            {
-              char_array_4[i] = kBase64Chars.find(char_array_4[i]);
-            }
-
-            char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-            char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-            char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
-
-            for (i = 0; (i < 3); i++)
-            {
-              ret += char_array_3[i];
-            }
-
-            i = 0;
-          }
+          backend.DrawImage(RecordedImageHandle(backend, player, img.Id),
+                            { img.X, img.Y, img.W, img.H },
+                            img.Angle,
+                            (SDL_RendererFlip)img.Flip);
         }
 
-        if (i)
+        if (player.Sprites().empty())
         {
-          for (j = i; j <4; j++)
-          {
-            char_array_4[j] = 0;
-          }
-
-          for (j = 0; j <4; j++)
-          {
-            char_array_4[j] = kBase64Chars.find(char_array_4[j]);
-          }
-
-          char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-          char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-          char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
-
-          for (j = 0; (j < i - 1); j++)
-          {
-            ret += char_array_3[j];
-          }
+          return;
         }
 
-        return ret;
-      }
-
-      // =======================================================================
+        backend.BeginSprites(player.Sprites().size());
 
-      std::vector<unsigned char> ConvertStringToBytes(const std::string& encodedStr)
-      {
-        std::vector<unsigned char> byteArray;
-        for (auto& c : encodedStr)
+        for (const RecordedImage& img : player.Sprites())
         {
-            byteArray.push_back(c);
+          backend.DrawSprite(RecordedImageHandle(backend, player, img.Id),
+                             { img.X, img.Y, img.W, img.H },
+                             img.Z,
+                             img.Angle,
+                             (SDL_RendererFlip)img.Flip,
+                             img.Tint);
         }
 
-        return byteArray;
+        backend.SubmitSprites();
       }
 
       // =======================================================================
 
-      std::vector<Position> GetPerimeter(int x,
-                                         int y,
-                                         int w,
-                                         int h,
-                                         bool includeCorners = true)
+      //
+      // Player unloads what was loaded for it on Close().
+      //
+      static int RecordedImageHandle(SDLBackend& backend,
+                                     FramePlayer& player,
+                                     int id)
       {
-        std::vector<Position> res;
+        int& handle = player.ImageHandle(id);
 
-        int x1 = x;
-        int x2 = x + w;
-        int y1 = y;
-        int y2 = y + h;
-
-        for (int i = x1; i <= x2; i++)
+        if (handle == -1)
         {
-          for (int j = y1; j <= y2; j++)
+          const auto& src = player.ImageSource(id);
+          handle = backend.LoadImage(src.first, src.second);
+
+          player.SetImageUnloader([&backend](int h)
           {
-            bool condCorners = (i == x1 && j == y1)
-                            || (i == x1 && j == y2)
-                            || (i == x2 && j == y1)
-                            || (i == x2 && j == y2);
+            backend.UnloadImage(h);
+          });
+        }
 
-            if (!includeCorners && condCorners)
-            {
-              continue;
-            }
+        return handle;
+      }
+      #endif
 
-            bool cond = (i == x1 || i == x2 || j == y1 || j == y2);
-            if (cond)
-            {
-              res.push_back(Position(i, j));
-            }
-          }
-        }
+      #ifdef PRINTER_STATS
+      // =======================================================================
 
-        return res;
+      static int64_t Microseconds(std::chrono::steady_clock::time_point from,
+                                  std::chrono::steady_clock::time_point to)
+      {
+        return std::chrono::duration_cast<std::chrono::microseconds>(to - from)
+               .count();
       }
 
       // =======================================================================
 
       //
-      // Here lies data after last ConvertHtmlToRGB() call.
+      // Counters of the frame being drawn.
       //
-      TileColor _convertedHtml;
+      FrameStats _drawStats;
 
-      std::unordered_map<uint32_t, TileColor> _validColorsCache;
-
-      const std::string kTileset8x16Base64 =
-          "Qk16gAEAAAAAAHoAAABsAAAAgAAAAAABAAABABgAAAAAAACAAQAjLgAAIy4AAAAAAAAAAAAAQkdScwAA"
-          "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAIAAAAAAAAAAAAAAAAA"
-          "AAD/AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////////////////////AP//////////////////////////AP//AP//////////"
-          "////////////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//////////AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////////////////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////////////////AP//AP//AP//AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//////////////"
-          "////////AP//AP//AP//AP//////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//////"
-          "////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//////////AP//AP//////AP//AP//AP//AP//////////////////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////AP//////////AP//AP//AP//AP//////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////AP//////////AP//////////AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//////////////////////////////"
-          "AP//AP//////////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//////////////////////////AP//AP//AP//////////////AP//AP//"
-          "AP//////////////AP//////////////AP//AP//AP//////////////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//////////////AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//////////AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//"
-          "////////AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//"
-          "////////AP//AP//AP//AP//////////////////////AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////////////AP//AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//////////////////////////"
-          "AP//AP//////////////////////////AP//AP//////////AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//////"
-          "////AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//////////AP//////////AP//////////////////////////AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//////////AP//AP//"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////"
-          "AP//AP//////////AP//////////////////////////////AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//////////AP//////////AP//////////////////AP//"
-          "////////AP//////////AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//////////////AP//AP//////////AP//////////AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//"
-          "AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//////////////////////AP//////////AP//"
-          "////////AP//////////////////AP//////////AP//////////AP//////////////////////AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////////AP//////////AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//////////////////////////AP//AP//////////"
-          "AP//AP//////////AP//////////AP//////////////AP//AP//AP//AP//////////////////AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//////////////////////////AP//AP//////////////////////////"
-          "AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//////////////////////////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//////////////AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//////////AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////AP//AP//AP//////"
-          "////////AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////"
-          "////AP//AP//AP//AP//AP//////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////////AP//AP//AP//////////////////////////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//"
-          "AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////////////////////////////////////////////////////////"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////////////////////////"
-          "////////////////////////////////////////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//////////////////////////////////////////////////////////////////////////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//////////////////////////////////////////////"
-          "////////////////////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////////"
-          "////////////////////////////////////////////////////////////////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////////////////////////////////////////////////////////"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////////////////////////"
-          "////////////////////////////////////////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//////////////////////////////////////////////////////////////////////////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////////////////////////////////////////////////////////////////"
-          "////////////////////AP//AP//////////////////////////AP//AP//AP//////////////////"
-          "////AP//AP//AP//////////////////////AP//AP//////////////////////////////////////"
-          "////////////////////////////////////////////////////////////////////////AP//AP//"
-          "AP//AP//AP//AP//////////////////////////////////////////////////////////////////"
-          "////////////////////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////////////////////////AP//AP//////"
-          "////AP//////////AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////////////////AP//AP//AP//"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//////////////////////////////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////"
-          "////////////////////AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////////////////////////////////////AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////////////////////"
-          "////AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////////////////////////////////AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////////////////////////AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////////"
-          "////////////////////////////////////////////////////AP//AP//AP//////////////////"
-          "////////////////////////////////////////////////////////////////////AP//AP//AP//"
-          "////////////////////AP//AP//////////AP//////////////AP//AP//////////////////////"
-          "////AP//AP//////////AP//////////////////////////////////////////////////////////"
-          "////AP//////////////AP//AP//////////AP//////////////////////////////////////////"
-          "////////////////////AP//////////////////////////////////////////////AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////////////"
-          "////AP//AP//////////AP//////////AP//AP//AP//////////AP//////////////AP//AP//////"
-          "////////////////////////////////////AP//////////////////////////////////////////"
-          "////AP//AP//////////AP//////////////////////////////////////////////////////////"
-          "////AP//////////////////////////////////////////////AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//////AP//AP//AP//////AP//"
-          "AP//////AP//////AP//////AP//////AP//AP//////////////AP//////////////AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////AP//AP//AP//////AP//////AP//////AP//////AP//////////////AP//"
-          "////////////AP//////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//////AP//AP//AP//////AP//AP//////AP//////"
-          "AP//////AP//////AP//AP//////////////AP//////////////AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////AP//AP//AP//////AP//////AP//////AP//////AP//////////////AP//////////////AP//"
-          "////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//////AP//AP//AP//////AP//AP//////AP//////AP//////AP//////"
-          "AP//AP//////////////AP//////////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////AP//AP//AP//"
-          "////AP//////AP//////AP//////AP//////////////AP//////////////AP//////AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//////AP//AP//AP//////AP//AP//////AP//////AP//////AP//////AP//AP//////////"
-          "////AP//////////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////AP//AP//AP//////AP//////AP//"
-          "////AP//////AP//////////////AP//////////////AP//////AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////AP//"
-          "AP//AP//////AP//AP//////AP//////AP//////AP//////AP//AP//////////////AP//////////"
-          "////AP//AP//AP//////////AP//AP//AP//////////////////////AP//AP//AP//////////////"
-          "////////AP//AP//AP//////////////////AP//////////AP//////////////////////////////"
-          "AP//////////////////////AP//AP//AP//////////////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//////////////////AP//////////AP//////////////////////////////"
-          "AP//////////////////////////////AP//////////////////////AP//AP//AP//////////////"
-          "////////AP//AP//AP//AP//AP//AP//////AP//AP//AP//////AP//////AP//////AP//////AP//"
-          "////////////AP//////////////AP//////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//////AP//"
-          "AP//////AP//////AP//////AP//////AP//AP//////////////AP//////////////AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////////////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////AP//AP//AP//////////////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//////////////////////////////AP//////////////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////AP//AP//AP//////AP//////AP//////AP//////AP//////////////AP//"
-          "////////////AP//////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//////AP//AP//////AP//////"
-          "AP//////AP//////AP//AP//////////////AP//////////////AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////AP//AP//AP//////AP//////AP//////AP//////AP//////////////AP//////////////AP//"
-          "////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////AP//AP//AP//////AP//AP//////AP//////AP//////AP//////"
-          "AP//AP//////////////AP//////////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//"
-          "////AP//////AP//////AP//////AP//////////////AP//////////////AP//////AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////////////////AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//////////"
-          "AP//AP//AP//////////////////AP//AP//AP//////////////////////AP//AP//AP//////////"
-          "////AP//////////AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////////////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//////AP//AP//////////AP//////////////AP//AP//"
-          "////AP//////////AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//"
-          "AP//////////////AP//////////AP//AP//////////////AP//AP//AP//////////////////AP//"
-          "AP//AP//AP//////////AP//////////AP//////////AP//////////AP//AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//////////AP//AP//AP//////////AP//AP//////////AP//////////AP//"
-          "AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//////////////////AP//AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////////////////AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//////////AP//////////AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//////////////////////////////"
-          "AP//AP//////////////////////////AP//AP//////////////////////AP//AP//AP//AP//////"
-          "////AP//AP//AP//AP//////////////////////////////AP//////////////////////////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////////////AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//////////"
-          "////////////AP//AP//////////AP//AP//////////AP//AP//////////AP//////////////AP//"
-          "AP//////////////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////"
-          "AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//////////AP//AP//AP//////"
-          "////////////////AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////////AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////AP//////////AP//AP//AP//AP//////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////////AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//"
-          "AP//////////////////////////////AP//AP//////////////AP//////////////////////AP//"
-          "AP//////////////AP//AP//////////////////////AP//AP//AP//////////////////////AP//"
-          "AP//AP//////////////////////AP//AP//AP//////////////AP//////////AP//AP//////////"
-          "////AP//////////AP//AP//////////////////////////AP//AP//////////////////////AP//"
-          "AP//AP//////////////////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////////"
-          "////////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////////////AP//AP//////"
-          "////AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//////////AP//"
-          "////////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////////AP//AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//////////////////////////AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////////////////////"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//AP//AP//AP//////////////////////////////////AP//////////"
-          "AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////////////////AP//"
-          "AP//AP//AP//AP//////////AP//////////////////AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//////////AP//////////////////AP//AP//AP//////////AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////////AP//////////////////////"
-          "////////////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//////////////////////////////////AP//////////AP//AP//////////"
-          "AP//AP//////////////////////////AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//////////////AP//////////AP//AP//////////AP//AP//AP//////////////////////AP//"
-          "AP//AP//////////////////////AP//AP//AP//////////////////////AP//AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//////////AP//AP//AP//////AP//AP//AP//AP//////////AP//AP//AP//////////////"
-          "////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//////////////////////AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "////////////AP//AP//////////AP//AP//AP//////////AP//AP//////////////////////////"
-          "AP//AP//////////AP//AP//////AP//AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////AP//AP//AP//////"
-          "////////AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//"
-          "AP//AP//////////////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//////////AP//AP//////////AP//"
-          "AP//AP//AP//////////AP//////////AP//AP//////////AP//AP//AP//AP//////////AP//////"
-          "////AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////AP//"
-          "AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "////AP//////////AP//AP//////////////////////AP//AP//AP//////////////AP//////////"
-          "AP//AP//////////////AP//////////AP//AP//////////////AP//////////AP//AP//////////"
-          "////AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//////////////////////AP//"
-          "AP//AP//////////////////////AP//AP//AP//////////////////////AP//AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//////////////////AP//AP//AP//AP//////////////////AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//////"
-          "////////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//////////AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//AP//////////////////AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//////"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//AP//////////AP//AP//////////AP//////////AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////////////////////////AP//////////////////////////////"
-          "AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//////////////"
-          "////////////////AP//AP//////////////////////AP//AP//AP//////////////////////AP//"
-          "AP//AP//////////////////////AP//AP//AP//////////////////////AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//////////////////////////////AP//////////////////////////////"
-          "AP//////////////////////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//////////////////////AP//"
-          "AP//AP//////////////////AP//AP//AP//AP//////////////////AP//AP//AP//AP//////////"
-          "////////AP//AP//AP//AP//////////////////AP//AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//////////////////////AP//AP//AP//////////////////////AP//AP//AP//////////"
-          "////////////AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//////////////AP//AP//"
-          "AP//AP//AP//////////////AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//////////AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////////AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////////////AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////////AP//AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//"
-          "AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "////////////AP//AP//AP//////////////////////AP//AP//////////////////AP//AP//AP//"
-          "AP//AP//////////////////////AP//AP//AP//AP//AP//////////////AP//AP//AP//////////"
-          "////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//////////AP//////////////////////////AP//////////////"
-          "////////////////AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//////////AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////"
-          "////AP//////////AP//////////AP//AP//////////AP//AP//AP//AP//////////////////AP//"
-          "AP//////////////////////////////////AP//////////AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////AP//AP//////////AP//AP//////////"
-          "AP//////////AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//////////AP//////////AP//////////AP//AP//////"
-          "////////////AP//AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//////////AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//////////AP//AP//AP//"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//AP//////////////////AP//"
-          "////////AP//////////AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//////////AP//////////AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//AP//////////AP//AP//////////////////AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//////////AP//////////AP//AP//////////AP//AP//AP//////////////AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//////////AP//"
-          "AP//////////AP//AP//////////AP//AP//AP//AP//////////////////AP//AP//AP//AP//////"
-          "////AP//////////AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//////////AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//////////AP//AP//////////AP//////////////AP//AP//AP//////////////AP//////////"
-          "AP//////////AP//////////////AP//AP//AP//////////////////////AP//AP//////////////"
-          "////////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//////////////////AP//AP//AP//AP//////////////////AP//"
-          "AP//AP//////////AP//////////////////////////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////////AP//AP//AP//"
-          "AP//AP//////////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//////////"
-          "AP//AP//////////////////////AP//AP//AP//////////////////////AP//AP//AP//////////"
-          "////AP//////////AP//AP//////////////////////AP//AP//////////////////AP//AP//AP//"
-          "AP//AP//////////////////////AP//AP//////////////AP//AP//////////AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//AP//AP//AP//////////AP//////////////AP//AP//////////"
-          "AP//AP//AP//////////////////AP//AP//////////AP//////////AP//////////AP//////////"
-          "AP//AP//////////AP//AP//////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//////////AP//AP//AP//////////AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//////////AP//"
-          "////////AP//////////AP//////////AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////AP//////////AP//////////AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//////"
-          "////AP//////////AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////////////////AP//AP//AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//////////////"
-          "////////////////AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//////////////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//////////AP//////////AP//////////AP//////////AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//////////AP//AP//////////AP//AP//AP//////////AP//////////////////AP//AP//AP//"
-          "AP//////////AP//AP//////////AP//AP//AP//////////////AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//////////AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//////////////////////////////////AP//////////"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////////AP//AP//AP//AP//////////////////AP//AP//AP//AP//////////"
-          "////////////AP//AP//AP//AP//////////////////AP//AP//AP//////////////////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//////////////AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//////////////"
-          "AP//AP//////////AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//////////////"
-          "AP//AP//////////AP//////////AP//////////////AP//AP//AP//////////////////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//////////////AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//"
-          "AP//AP//////////////////////AP//AP//////////////AP//AP//////////AP//AP//////////"
-          "////////////AP//AP//AP//AP//////////////////AP//AP//AP//////////////////////AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//////////AP//"
-          "AP//AP//AP//////////AP//AP//////////////////AP//AP//////////////////////////////"
-          "////AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//////////AP//////////////////AP//AP//////////"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//////////////////AP//AP//AP//////////"
-          "AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//"
-          "AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//"
-          "////AP//////////AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//////////AP//////////////////////////////////AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//////AP//AP//////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//AP//////////////////AP//////////AP//////"
-          "////AP//AP//////////////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////////AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//////"
-          "////////////AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//"
-          "AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////////////////AP//AP//AP//AP//////"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//////////////////AP//AP//AP//AP//////////AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////////////AP//"
-          "AP//AP//AP//////////AP//AP//////////////////AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//////AP//AP//////////AP//AP//////////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//AP//////////AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//////////////AP//AP//AP//AP//////////AP//AP//AP//////"
-          "////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//////////AP//////////AP//////////////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//AP//////////////////AP//AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//////////////////AP//AP//AP//AP//////////////////AP//"
-          "AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////AP//AP//AP//////////////////////AP//"
-          "AP//////////////////////////AP//AP//AP//////////////////////AP//AP//////////////"
-          "////////////////////////////AP//AP//AP//////////AP//////////AP//AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//////////////////AP//AP//AP//AP//////////////////AP//"
-          "AP//AP//AP//////////////////////////////////////////AP//AP//////////////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////////////AP//AP//////////AP//AP//AP//////////AP//////////////"
-          "////////////AP//AP//AP//AP//////////////////AP//AP//////////////////////AP//AP//"
-          "AP//////////////////////////////AP//////////////////AP//AP//AP//AP//AP//AP//////"
-          "////////AP//////AP//////////AP//AP//AP//////////AP//AP//AP//////////////////AP//"
-          "AP//AP//////////////////AP//AP//AP//////////////AP//AP//////////AP//////////////"
-          "////////////////AP//////////AP//AP//AP//AP//////////////////AP//AP//AP//////////"
-          "AP//AP//////////////////////AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//AP//////"
-          "////////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "////////////AP//AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//////AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//////AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//////////AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//////"
-          "AP//////////AP//AP//AP//AP//////////////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//////////AP//////////////////AP//////////AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////AP//AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//////////////////"
-          "AP//////////////////////////////AP//AP//////////AP//AP//////////AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//////////AP//////AP//AP//"
-          "AP//AP//////////AP//////AP//AP//AP//////////AP//////////////////AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//////////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//////////////////AP//AP//////////////AP//////////AP//AP//AP//////////"
-          "AP//////////AP//////////////////AP//////////AP//AP//AP//////////AP//AP//////////"
-          "////////////AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//////////////////AP//AP//AP//AP//////////////////AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//////////////////AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//////////AP//////////AP//////////////////AP//////////////////"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//////////AP//////AP//AP//AP//AP//////////"
-          "AP//////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//////////////////////////////"
-          "////////////////////////////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//AP//////AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//////AP//AP//////////AP//AP//AP//////AP//////////AP//AP//AP//AP//////"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//AP//AP//"
-          "AP//////////////////////////////////////////////////AP//////////AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//////////////AP//AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//////////AP//AP//////////"
-          "AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//////////AP//AP//AP//AP//AP//////////////AP//AP//////////////////////////"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//////////////////////AP//"
-          "AP//AP//AP//AP//////AP//AP//AP//AP//////////////////////////AP//AP//AP//AP//////"
-          "////////////AP//AP//////////////////////AP//AP//AP//////////////////////////////"
-          "AP//////////////////////////////AP//AP//AP//////////////////AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//////////////////AP//AP//AP//AP//AP//////////////////"
-          "AP//////////////AP//AP//////////AP//////////////////AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//////////AP//AP//////////////////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////AP//AP//AP//////////"
-          "////////////////AP//////////////////////////////AP//AP//////////////////////AP//"
-          "AP//AP//AP//AP//////////////////AP//AP//////////////////////AP//AP//AP//////////"
-          "////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////////////////AP//"
-          "AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////"
-          "////////////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//////////////////AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////////////////////////"
-          "AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////////////AP//"
-          "AP//////////AP//AP//////////AP//AP//////////////////////////AP//AP//////////////"
-          "////////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////////////////AP//"
-          "AP//AP//////////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//"
-          "AP//////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//////////AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//////////////////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//////////AP//AP//AP//////////AP//AP//////////////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////"
-          "////////////AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//////////////AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//////////////AP//AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//////////////////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////"
-          "////////////AP//AP//AP//////////////////////AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//////////////////////////////AP//AP//AP//////////////AP//AP//AP//////////////"
-          "////////////////AP//AP//////////////////////AP//AP//AP//////////////////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////////////////AP//AP//////AP//AP//"
-          "AP//AP//////////AP//AP//////////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//////////AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//////////AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////////////AP//////AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//"
-          "AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//////////AP//"
-          "////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//////////////////////////////////AP//////////"
-          "////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////AP//////////AP//AP//AP//////////////////////AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//////////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////AP//////////AP//"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//////////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//AP//////AP//AP//////AP//AP//AP//////////"
-          "AP//////////AP//AP//////////AP//AP//AP//AP//////AP//////////AP//AP//AP//AP//////"
-          "AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//////////AP//////////AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//////"
-          "////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//AP//"
-          "////////AP//////////////////AP//AP//AP//////////AP//////////////////////////////"
-          "AP//AP//////////////////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////"
-          "AP//AP//////////AP//AP//AP//AP//////////AP//////////AP//AP//AP//AP//////////AP//"
-          "AP//////////////////////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////AP//AP//AP//AP//////AP//AP//AP//"
-          "AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//////"
-          "////AP//AP//////////////AP//AP//AP//////////////////////////////AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////////////////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////////"
-          "////////////////AP//AP//AP//////AP//AP//////AP//AP//////////////////////////////"
-          "AP//AP//AP//////////////AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "////////////////AP//AP//////////////////////////AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//AP//////////AP//////////AP//////////AP//////////AP//AP//////////////"
-          "////////////////AP//AP//////////////////////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////"
-          "AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////"
-          "AP//AP//////////////////////AP//AP//AP//AP//////////////AP//AP//AP//////////////"
-          "////////AP//AP//AP//AP//AP//////////////////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//AP//AP//////////AP//////////////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////////"
-          "////////////////AP//////////////////////////////AP//////////AP//AP//AP//AP//AP//"
-          "AP//////////////////////////////////AP//////////////////////AP//AP//AP//////////"
-          "////////////AP//AP//////////////////////////////AP//////////////////////////////"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//AP//////////"
-          "////////AP//////////////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//"
-          "AP//////////AP//AP//AP//AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//////"
-          "////////AP//AP//AP//AP//////////////////////AP//AP//////////////////////AP//AP//"
-          "AP//AP//AP//////////////////////AP//AP//AP//AP//////////AP//AP//AP//AP//////////"
-          "AP//AP//////////AP//////////AP//////////AP//////////AP//////////AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "AP//AP//////AP//AP//AP//AP//////////////AP//AP//AP//////////////////////////////"
-          "AP//////////////////AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//////////"
-          "////////////////AP//AP//////////AP//AP//////////AP//////////AP//////////AP//////"
-          "////AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////"
-          "////////////////AP//AP//////////////////////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//"
-          "AP//////////////////////////////AP//////////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////AP//AP//AP//////////////////AP//AP//AP//////////AP//AP//////////"
-          "AP//////////AP//////////AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//////////////////AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//////////AP//AP//////////AP//AP//////////////////////////////////////AP//"
-          "AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//////////////////////////AP//AP//////////////////////////AP//AP//AP//AP//"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////"
-          "////AP//////////////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////////"
-          "AP//AP//AP//AP//AP//////////////AP//AP//////////AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//////////////////"
-          "////////////////////AP//AP//////////////AP//AP//AP//AP//AP//AP//////AP//AP//AP//"
-          "AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////////AP//AP//////////////////AP//"
-          "AP//////////AP//AP//AP//AP//////////////////AP//AP//////////AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//////////////////AP//AP//AP//AP//////////////AP//AP//////////"
-          "////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//"
-          "AP//AP//AP//AP//////////////////////////////////////AP//////////////////////AP//"
-          "AP//AP//AP//////////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//////////////AP//AP//////////"
-          "////AP//////////AP//AP//////////AP//////AP//AP//////////AP//AP//////////////AP//"
-          "AP//////////AP//AP//AP//////////////////////////AP//AP//////////////AP//AP//AP//"
-          "AP//AP//////////AP//AP//////////////////////AP//////////AP//////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////AP//AP//////////AP//AP//////////////////AP//AP//////////"
-          "////////////////////////////////AP//AP//////////////////////AP//AP//////////////"
-          "AP//AP//////////////AP//////////////////////////AP//AP//AP//////////////////AP//"
-          "AP//////////AP//AP//AP//AP//////////AP//////AP//AP//AP//AP//////AP//////AP//////"
-          "////////////AP//////////////AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//"
-          "AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//////"
-          "////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//////////////////AP//"
-          "////////////AP//AP//AP//AP//////////////////////////////////////AP//////////////"
-          "////////////////AP//////////////AP//AP//////////////////////////////////////////"
-          "////AP//AP//////////////////AP//AP//////////AP//AP//AP//AP//////////AP//////AP//"
-          "AP//AP//AP//////AP//////AP//////////////////AP//////////////AP//AP//////////AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//AP//////////AP//AP//AP//AP//AP//////////"
-          "AP//AP//AP//////////////////////AP//AP//////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////AP//AP//AP//AP//AP//AP//////////////////////////////////////////////////"
-          "////////////////AP//AP//////////////////////AP//AP//////////////AP//AP//////////"
-          "////////////////////////////////////AP//AP//AP//////////AP//AP//AP//////////////"
-          "AP//AP//////////////AP//////////AP//AP//////////AP//////AP//AP//////////AP//AP//"
-          "////AP//////////////////AP//AP//AP//AP//////////AP//AP//////////AP//AP//AP//////"
-          "////AP//AP//AP//AP//AP//////////AP//AP//AP//////////AP//AP//////////////////AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//////////////////"
-          "////////////////////////////////////////////////AP//AP//AP//////////////AP//AP//"
-          "AP//AP//AP//////////////////AP//AP//AP//////////////////////////AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////////AP//AP//////////////////AP//"
-          "AP//////////AP//AP//AP//AP//////////AP//AP//////////AP//AP//////AP//AP//////////"
-          "AP//AP//////////AP//AP//AP//////////AP//AP//AP//AP//AP//////////AP//AP//AP//////"
-          "////////////AP//////////AP//////////AP//AP//AP//AP//AP//AP//AP//AP//////AP//////"
-          "AP//AP//////AP//////////////AP//////////AP//////////AP//////////AP//////////AP//"
-          "AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//////////////////AP//AP//AP//AP//////"
-          "////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//"
-          "////////AP//////AP//AP//////////AP//AP//////////AP//AP//AP//////////////////////"
-          "////AP//////////////////////////////AP//AP//AP//////////AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////AP//AP//AP//AP//AP//AP//////////////////////////////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////////////////AP//AP//AP//AP//////////////AP//AP//////////AP//AP//////////"
-          "AP//AP//AP//////////AP//AP//////////AP//////////AP//AP//AP//////////AP//AP//AP//"
-          "////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////"
-          "AP//AP//////////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//////////////////"
-          "AP//AP//AP//////////////////AP//AP//AP//AP//////////////////////////AP//////////"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//////////////"
-          "////////////////////AP//AP//AP//AP//AP//AP//AP//AP//////////////////////////////"
-          "////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//"
-          "AP//////////////////////////////////AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//AP//"
-          "AP//AP//AP//AP//AP//AP//AP//AP//AP8=";
-#endif
+      std::chrono::steady_clock::time_point _clearEnd;
+      #endif
   };
 
+  // ===========================================================================
+
+#if defined(USE_SDL)
+  using Printer = BasicPrinter<SDLBackend>;
+#elif defined(USE_VT)
+  using Printer = BasicPrinter<VTBackend>;
+#elif defined(USE_HEADLESS)
+  using Printer = BasicPrinter<HeadlessBackend>;
+#else
+  using Printer = BasicPrinter<CursesBackend>;
+#endif
+
 } // namespace Printer
 
 #endif // include guard